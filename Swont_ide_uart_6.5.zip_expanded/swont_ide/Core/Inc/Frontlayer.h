@@ -10,20 +10,43 @@
 
 
 #include "main.h"
+#include "macro.h"
+#include <stdbool.h>
 
 #define maxTextLen 128
 #define maxFontnameLen 30
 #define maxColorLen 12
+#define maxModeLen 12	//the longest mode name ("320x240x8") and the '\0'
+#define maxStatLen 8	//the longest handler name of histogram ("latency", "usart2") and the '\0'
 #define line 'l'
 #define text 't'
 #define rectangle 'r'
 #define bitmap 'b'
 #define clearscreen 'c'
+#define batchBegin 'B'	//"begin": the next functions are recorded, not drawn
+#define batchCommit 'C'	//"commit": draw the recorded functions at the vertical blank
+#define macroRecord 'R'	//"record,name": the next functions are recorded for a macro
+#define macroSave 'S'	//"save": store the recorded functions in flash
+#define macroPlay 'P'	//"play,name": draw a stored macro
+#define macroList 'L'	//"list": print the stored macros
+#define macroErase 'E'	//"erase,name": erase a stored macro, "erase,*" erases all
+#define videoMode 'M'	//"mode,320x240x8" or "mode,80x30" (text): select the video mode, the screen is cleared to white
+#define spriteSet 'G'	//"sprite,nr,bitmap,color,z": show a bitmap as sprite nr, an unknown bitmap hides it
+#define spriteMove 'V'	//"move,nr,x,y": move sprite nr, nothing is redrawn
+#define isrStats 'T'	//"stats": print the timing of the interrupt handlers and start over (ISR_STATS)
+#define isrHistogram 'H'	//"histogram,tim2": print the cycles histogram of a handler (ISR_STATS)
 #define lineLen 6
 #define textLen 7
 #define rectangleLen 8
 #define bitmapLen 3
 #define clearscreenLen 1
+#define batchLen 0
+#define macroLen 1
+#define modeLen 1
+#define histogramLen 1
+#define spriteLen 4
+#define moveLen 3
+#define maxArguments 9	//the function name + the arguments of the longest function (rectangle)
 #define NOTEXT 0
 #define YESTEXT 1
 #define argumentZERO 0
@@ -37,16 +60,33 @@
 #define argumentEIGHT 8
 #define firstCharacter 0
 
+// Binary protocol: binSOF, LEN, LEN bytes of commands, CRC-16/CCITT (little-endian) over LEN and the commands
+// Every command is an opcode followed by its fields, numbers are little-endian,
+// colors are indices in the color table (zwart, blauw, lichtblauw, groen, lichtgroen, cyaan, lichtcyaan,
+// rood, lichtrood, magenta, lichtmagenta, bruin, geel, grijs, wit)
+#define binSOF 0xA5	//first byte of a frame, never part of a text line
+#define binHeaderLen 2	//binSOF + LEN
+#define binCrcLen 2
+#define binLine 0x01	//x1, y1, x2, y2 (uint16_t), color, weight
+#define binRectangle 0x02	//xlup, ylup, width, height (uint16_t), color, filled, bordercolor, linewidth
+#define binText 0x03	//xlup, ylup (uint16_t), color, font, fontsize, fontstyle, length, length characters
+#define binBitmap 0x04	//nr, xlup, ylup (uint16_t)
+#define binClearscreen 0x05	//color
+#define binBegin 0x06	//no fields
+#define binCommit 0x07	//no fields
+#define binPlay 0x08	//macro number (as printed by list)
+#define binMove 0x09	//sprite number, x, y (int16_t)
+
 typedef struct
 {
-	uint8_t nr;
+	uint16_t nr;
     uint16_t xlup;
     uint16_t ylup;
 }BITMAP_S;
 
 typedef struct
 {
-	char color[maxColorLen];
+	uint8_t color;
 }CLEARSCREEN_S;
 
 typedef struct
@@ -55,7 +95,7 @@ typedef struct
     uint16_t y1;
     uint16_t x2;
     uint16_t y2;
-    char color[maxColorLen];
+    uint8_t color;
     uint8_t weight;
 }LINE_S;
 
@@ -63,11 +103,11 @@ typedef struct
 {
     uint16_t xlup;
     uint16_t ylup;
-    uint8_t width;
-    uint8_t height;
-    char color[maxColorLen];
+    uint16_t width;
+    uint16_t height;
+    uint8_t color;
     uint8_t filled;
-    char bordercolor[maxColorLen];
+    uint8_t bordercolor;
     uint8_t linewidth;
 } RECTANGLE_S;
 
@@ -75,21 +115,59 @@ typedef struct
 {
     uint16_t xlup;
     uint16_t ylup;
-    char color[maxColorLen];
-    char textin[maxTextLen];
-    char fontname[maxFontnameLen];
+    uint8_t color;
+    uint8_t fontname;
     uint8_t fontsize;
-    char fontstyle[maxColorLen];
+    uint8_t fontstyle;
+    char textin[maxTextLen];	//last, so a batch only records the used part
 }TEXT_S;
 
+typedef struct
+{
+	char name[MACRO_NAMELEN];	//"" when a binary frame gives the number
+	uint8_t nr;
+}MACRO_S;
+
+typedef struct
+{
+	uint16_t bm;	//bitmap number
+	uint8_t nr;
+	uint8_t color;
+	uint8_t z;
+}SPRITE_S;
+
+typedef struct
+{
+	int16_t x;
+	int16_t y;
+	uint8_t nr;
+}MOVE_S;
+
+typedef struct
+{
+	char name[maxModeLen];
+}MODE_S;
+
+typedef struct
+{
+	char name[maxStatLen];
+}HISTOGRAM_S;
+
 extern LINE_S line_s;
 extern BITMAP_S bitmap_s;
 extern CLEARSCREEN_S clearscreen_s;
 extern LINE_S line_s;
 extern RECTANGLE_S rectangle_s;
 extern TEXT_S text_s;
+extern MACRO_S macro_s;
+extern SPRITE_S sprite_s;
+extern MOVE_S move_s;
+extern MODE_S mode_s;
+extern HISTOGRAM_S histogram_s;
+extern char fl_function;
 
-void FL_Input(void);
+bool FL_Input(void);
+bool FL_FrameValid(const uint8_t *frame, uint16_t len);
 
 
 #endif /* INC_FRONTLAYER_H_ */
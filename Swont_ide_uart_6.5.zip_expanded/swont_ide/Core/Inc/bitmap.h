@@ -15,24 +15,47 @@
 //--------------------------------------------------------------
 // Defines
 //--------------------------------------------------------------
-#define BM_AMOUNT (200)
+#define BM_AMOUNT (156)
 #define STANDARD_BM_SIZE (16)
 #define TEXT_SIZE (8)
 #define ALPHABET_SIZE (26)
+#define BM_ROW_BYTES(xlen) (((xlen) + 7) / 8) // bytes per bitmap row (1 bit per pixel)
+#define BM_ID_RANGES (4)
+#define BM_FONTS (2)
+#define BM_STYLES (3)
+#define FONT_CHARS (128)  // ASCII, see font_8x8
+#define FONT_ROWS (8)
 
 //--------------------------------------------------------------
-// Macro's
+// Bitmap directory entry
 //--------------------------------------------------------------
-#define ID (0)
-#define X_LEN (1)
-#define Y_LEN (2)
-#define OFFSET (3)
+typedef struct {
+  uint8_t x_len;    // width in pixels
+  uint8_t y_len;    // height in pixels
+  uint16_t offset;  // first byte in bitmap_1bpp
+}BM_INFO_t;
+
+//--------------------------------------------------------------
+// Range of consecutive bitmap IDs
+//--------------------------------------------------------------
+typedef struct {
+  uint16_t first_id; // ID of the first bitmap in the range
+  uint16_t count;    // amount of IDs in the range
+  uint16_t first_nr; // index in bmInfo of the first bitmap
+}BM_ID_RANGE_t;
 
 //--------------------------------------------------------------
 // Global variables
 //--------------------------------------------------------------
-extern uint16_t bmLookup[BM_AMOUNT][4];
-extern const uint16_t bitmap_test[];
+extern const uint8_t bitmap_1bpp[];
+extern const BM_INFO_t bmInfo[BM_AMOUNT];
+extern const uint8_t font_8x8[FONT_CHARS][FONT_ROWS];
+
+//--------------------------------------------------------------
+// Global Function call
+//--------------------------------------------------------------
+const BM_INFO_t *Bitmap_find(uint16_t id);
+const BM_INFO_t *Bitmap_glyph(uint8_t font, uint8_t style, char letter);
 
 //--------------------------------------------------------------
 #endif // __BITMAP_H
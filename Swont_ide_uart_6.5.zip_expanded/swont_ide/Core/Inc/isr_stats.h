@@ -0,0 +1,48 @@
+/*
+ * isr_stats.h
+ *
+ *  Created on: 17 okt. 2026
+ *
+ * Timing of the interrupt handlers with the DWT cycle counter, printed by the
+ * stats and histogram commands. ISR_STATS 0 (main.h) removes it, the macros are empty then.
+ */
+
+#ifndef INC_ISR_STATS_H_
+#define INC_ISR_STATS_H_
+
+#include "main.h"
+
+#define ISR_STAT_LATENCY 0	//TIM2 compare CC3 -> first instruction of TIM2_IRQHandler, only TIM2
+#define ISR_STAT_TIM2 1		//TIM2_IRQHandler
+#define ISR_STAT_TIM3 2		//TIM3_IRQHandler, the end of every line
+#define ISR_STAT_USART2 3	//USART2_IRQHandler
+#define ISR_STAT_COUNT 4
+
+#define ISR_STATS_BINS 10		//bin 0: < 64 cycles, bin n: < 64 << n, the last bin: the rest
+#define ISR_STATS_FIRST_BIN 64
+#define ISR_STATS_TIM_CYCLES 2	//core cycles per TIM2 tick: 168 MHz HCLK, 84 MHz APB1 timer clock
+
+#if ISR_STATS
+
+// ISR_STATS_ENTER first in a handler, ISR_STATS_EXIT last: the cycles in between are recorded
+#define ISR_STATS_ENTER() uint32_t isr_start = DWT->CYCCNT
+#define ISR_STATS_EXIT(stat) ISR_STATS_Record(stat, DWT->CYCCNT - isr_start)
+// the ticks of timer tim since its compare value ccr, the counter is read right away
+#define ISR_STATS_LATENCY(stat, tim, ccr) ISR_STATS_Latency(stat, (tim)->CNT, (tim)->ARR, ccr)
+
+void ISR_STATS_Init(void);
+void ISR_STATS_Record(uint8_t stat, uint32_t cycles);
+void ISR_STATS_Latency(uint8_t stat, uint32_t cnt, uint32_t arr, uint32_t ccr);
+void ISR_STATS_Print(void);
+void ISR_STATS_Histogram(const char *name);
+
+#else
+
+#define ISR_STATS_ENTER()
+#define ISR_STATS_EXIT(stat)
+#define ISR_STATS_LATENCY(stat, tim, ccr)
+#define ISR_STATS_Init()
+
+#endif
+
+#endif /* INC_ISR_STATS_H_ */
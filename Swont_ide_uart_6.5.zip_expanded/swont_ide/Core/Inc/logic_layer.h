@@ -8,8 +8,12 @@
 #ifndef INC_LOGIC_LAYER_H_
 #define INC_LOGIC_LAYER_H_
 
+#define BATCH_BUFLEN 4096	//bytes for the functions recorded between begin and commit
 
-
-//void logic (char);
+void logic(void);
+int color_check(const char *color);
+int style_check(const char *stl);
+int font_check(const char *fnt);
+int mode_check(const char *mode);
 
 #endif /* INC_LOGIC_LAYER_H_ */
@@ -0,0 +1,26 @@
+/*
+ * macro.h
+ *
+ *  Created on: 17 okt. 2026
+ */
+
+#ifndef INC_MACRO_H_
+#define INC_MACRO_H_
+
+#include "main.h"
+#include <stdbool.h>
+
+// The macros are kept in the last flash sector, the linker script leaves it free
+#define MACRO_SECTOR FLASH_SECTOR_11
+#define MACRO_START 0x080E0000
+#define MACRO_END 0x08100000	//MACRO_START + 128K
+#define MACRO_NAMELEN 16		//including the '\0'
+#define MACRO_MAGIC 0x4D430001	//"MC" + version, raise the version when a recorded struct changes
+
+bool MACRO_Save(const char *name, const uint8_t *data, uint16_t len);
+const uint8_t *MACRO_Find(const char *name, uint16_t *len);
+const uint8_t *MACRO_Get(uint8_t nr, uint16_t *len);
+bool MACRO_Erase(const char *name);
+void MACRO_List(void);
+
+#endif /* INC_MACRO_H_ */
@@ -87,10 +87,16 @@ void Error_Handler(void);
 #define VGA_VSYNC_GPIO_Port GPIOB
 /* USER CODE BEGIN Private defines */
 
-#define BYTE_BUFLEN 	 1
+#define RX_DMA_BUFLEN 	 64	/* circular DMA receive buffer of USART2 */
 #define LINE_BUFLEN 	 1024
+#define CMD_QUEUE_DEPTH  8	/* complete command lines buffered between the UART and the main loop */
+#define RX_FRAME_GAP 	 6	/* ms: a binary frame that pauses longer (a DMA buffer of bytes) is cut off */
+#define TX_BUFLEN 		 256	/* transmit ring of USART2, bytes that don't fit are dropped */
 #define CARRIAGE_RETURN  13 /* carriage return char \r */
 #define LINE_FEED 		 10 /* linefeed char \n		   */
+#ifndef ISR_STATS
+#define ISR_STATS 		 1	/* DWT timing of the interrupt handlers (isr_stats.c), 0 leaves it out */
+#endif
 
 #define FALSE 	0x00
 #define TRUE 	0xFF
@@ -98,12 +104,20 @@ void Error_Handler(void);
 /* Struct's ------------------------------------------------------------------*/
 typedef struct
 {
-	uint8_t byte_buffer_rx[BYTE_BUFLEN];	// Store the rx byte from the USART2
-	char line_rx_buffer[LINE_BUFLEN];		// Buffer to hold all the bytes from rx USART2
+	uint8_t dma_buffer_rx[RX_DMA_BUFLEN];	// The DMA stores the rx bytes from the USART2 here
+	volatile uint16_t dma_read_pos;			// First byte in dma_buffer_rx not yet handled
+	char rx_queue[CMD_QUEUE_DEPTH][LINE_BUFLEN];	// Ring of command lines, filled by the UART interrupt
+	int rx_queue_len[CMD_QUEUE_DEPTH];		// Length of every line in rx_queue
+	volatile uint8_t queue_head;			// Slot the UART interrupt fills (only written by the interrupt)
+	volatile uint8_t queue_tail;			// Slot the main loop handles (only written by the main loop)
+	volatile uint32_t queue_overflow;		// Lines dropped because the queue was full
+	volatile uint32_t line_overflow;		// Characters dropped because the line was too long
+	int char_counter;						// Counter for the slot being filled
+	uint16_t frame_left;					// Bytes left of the binary frame being received, 0 = text line
+	uint8_t rx_idle;						// 1 = the line went idle, the next bytes may end a frame (UART_RxIdle)
+	uint32_t idle_tick;						// HAL_GetTick when the line went idle
+	char *line_rx_buffer;					// The line being handled by FL_Input and logic
 	int msglen;								// Counter for line_rx_buffer length
-	volatile int char_counter;				// Counter for line_rx_buffer
-	char command_execute_flag;				/* Set = whole transmission is received, ready for processing \
-											   Reset = still receiving*/
 }input_vars;
 extern input_vars input;
 
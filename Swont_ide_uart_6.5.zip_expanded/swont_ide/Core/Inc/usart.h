@@ -31,6 +31,8 @@
 /* USER CODE END Includes */
 
 extern UART_HandleTypeDef huart2;
+extern DMA_HandleTypeDef hdma_usart2_rx;
+extern DMA_HandleTypeDef hdma_usart2_tx;
 
 /* USER CODE BEGIN Private defines */
 
@@ -39,6 +41,14 @@ extern UART_HandleTypeDef huart2;
 void MX_USART2_UART_Init(void);
 
 /* USER CODE BEGIN Prototypes */
+void UART_RxStart(void);
+void UART_RxCheck(void);
+void UART_RxIdle(void);
+uint8_t UART_GetLine(void);
+void UART_ReleaseLine(void);
+void UART_Send(const uint8_t *data, uint16_t len);
+void UART_Print(const char *str);
+extern volatile uint32_t tx_dropped;
 
 /* USER CODE END Prototypes */
 
@@ -7,12 +7,65 @@
 #include "Frontlayer.h"
 #include "usart.h"
 #include "main.h"
+#include "logic_layer.h"
 #include <stdbool.h>
 
-void arg(uint8_t, char*, bool);
-bool checkFunctionLen(uint8_t);
+typedef struct
+{
+	uint16_t start;	//offset of the first character in line_rx_buffer
+	uint16_t len;	//amount of characters up to the next ',' or the end of the line
+}ARG_S;
+
+typedef struct
+{
+	const char *name;	//the whole function name
+	char function;		//the value of fl_function
+	uint8_t len;		//the amount of arguments
+}WORD_S;
 
-char string_container[128];
+static bool textInput(void);
+static bool binCheckFrame(void);
+static bool binInput(void);
+static bool binColor(uint8_t, uint8_t*);
+static uint16_t binU16(const uint8_t*);
+static uint16_t crc16(const uint8_t*, uint16_t);
+static void tokenize(void);
+static bool checkFunctionLen(uint8_t);
+static int32_t argNumber(uint8_t);
+static void argString(uint8_t, char*, uint16_t, bool);
+static bool argName(uint8_t, uint8_t*, int (*)(const char*));
+
+static ARG_S args[maxArguments];	//the arguments of the current line, 0 = the function name
+static uint16_t argCount;			//the amount of arguments in the current line (commas + 1)
+static uint16_t flPos;				//the next function in a binary frame, 0 = a new line
+static bool argRange;				//a number argument of the current line doesn't fit in an int32_t
+
+//the functions that are whole words, their first letter would be read as bitmap, clearscreen etc.
+static const WORD_S words[] =
+{
+	{"begin", batchBegin, batchLen},
+	{"commit", batchCommit, batchLen},
+	{"record", macroRecord, macroLen},
+	{"save", macroSave, batchLen},
+	{"play", macroPlay, macroLen},
+	{"list", macroList, batchLen},
+	{"erase", macroErase, macroLen},
+	{"mode", videoMode, modeLen},
+	{"sprite", spriteSet, spriteLen},
+	{"move", spriteMove, moveLen},
+#if ISR_STATS
+	{"stats", isrStats, batchLen},
+	{"histogram", isrHistogram, histogramLen},
+#endif
+};
+
+//the color table of the binary protocol
+static const uint8_t binColors[] =
+{
+	VGA_COL_BLACK, VGA_COL_BLUE, VGA_COL_LIGHTBLUE, VGA_COL_GREEN, VGA_COL_LIGHTGREEN,
+	VGA_COL_CYAN, VGA_COL_LIGHTCYAN, VGA_COL_RED, VGA_COL_LIGHTRED, VGA_COL_MAGENTA,
+	VGA_COL_LIGHTMAGENTA, VGA_COL_BROWN, VGA_COL_YELLOW, VGA_COL_GRAY, VGA_COL_WHITE
+};
 
 LINE_S line_s;
 BITMAP_S bitmap_s;
@@ -20,160 +73,497 @@ CLEARSCREEN_S clearscreen_s;
 LINE_S line_s;
 RECTANGLE_S rectangle_s;
 TEXT_S text_s;
+MACRO_S macro_s;
+SPRITE_S sprite_s;
+MOVE_S move_s;
+MODE_S mode_s;
+HISTOGRAM_S histogram_s;
+char fl_function;	//the function FL_Input loaded last
 
 
 //--------------------------------------------------------------
 // @brief Function load input into structs
+// @details This function loads the next function of the line into its struct and
+//			fl_function. A text line holds one function, a binary frame (first byte binSOF)
+//			can hold several: call FL_Input until it returns false.
+//
+// @return true when a function is loaded, false when the line holds no more (valid) functions
+//--------------------------------------------------------------
+bool FL_Input()
+{
+	bool binary = ((uint8_t)input.line_rx_buffer[firstCharacter] == binSOF);
+
+	if(flPos == 0)	//a new line
+	{
+		if(binary == false)
+		{
+			flPos = 1;	//the next call ends the line
+			if(textInput() == true)
+			{
+				if(argRange == false)
+					return true;
+				UART_Print("Error: number out of range\n\r");
+			}
+			flPos = 0;
+			return false;
+		}
+		if(binCheckFrame() == false)
+			return false;
+		flPos = binHeaderLen;
+	}
+	else if(binary == false)
+	{
+		flPos = 0;
+		return false;
+	}
+
+	if(binInput() == true)
+		return true;
+	flPos = 0;
+	return false;
+}
+
+//--------------------------------------------------------------
+// @brief Function load a text line into structs
 // @details This function loads the different arguments into the assigned structs
+//
+// @return true when the function and its arguments are valid
 //--------------------------------------------------------------
-void FL_Input()
+static bool textInput(void)
 {
+	char name[maxFontnameLen];
+	uint8_t i;
+
+	tokenize();	//one pass over the line, after this only the arguments are read
+
+	fl_function = input.line_rx_buffer[firstCharacter];
+
+	argString(argumentZERO, name, sizeof(name), NOTEXT);
+	for(i = 0; i < sizeof(words) / sizeof(words[0]); i++)
+	{
+		if(strcmp(name, words[i].name) == 0)
+		{
+			fl_function = words[i].function;
+			if(checkFunctionLen(words[i].len) == true)
+				return false;
+			if(fl_function == spriteSet)
+			{
+				sprite_s.nr = argNumber(argumentONE);
+				sprite_s.bm = argNumber(argumentTWO);
+				sprite_s.z = argNumber(argumentFOUR);
+				return argName(argumentTHREE, &sprite_s.color, color_check);
+			}
+			if(fl_function == spriteMove)
+			{
+				move_s.nr = argNumber(argumentONE);
+				move_s.x = argNumber(argumentTWO);
+				move_s.y = argNumber(argumentTHREE);
+				return true;
+			}
+			if(fl_function == videoMode)
+			{
+				argString(argumentONE, mode_s.name, sizeof(mode_s.name), NOTEXT);
+				return true;
+			}
+			if(fl_function == isrHistogram)
+			{
+				argString(argumentONE, histogram_s.name, sizeof(histogram_s.name), NOTEXT);
+				return true;
+			}
+			argString(argumentONE, macro_s.name, sizeof(macro_s.name), NOTEXT);	//"" when there is no argument
+			return true;
+		}
+	}
+
 	switch(input.line_rx_buffer[firstCharacter])
 	{
 		case line:	//if the function line is called
 			if(checkFunctionLen(lineLen) == false)
 			{
-				arg(argumentONE, string_container, NOTEXT);	//collects the information from argument 1
-				line_s.x1 = atoi(string_container);	//stores the information from argument 1 into line struct
-				arg(argumentTWO, string_container, NOTEXT);	//etc
-				line_s.y1 = atoi(string_container);
-				arg(argumentTHREE, string_container, NOTEXT);
-				line_s.x2 = atoi(string_container);
-				arg(argumentFOUR, string_container, NOTEXT);
-				line_s.y2 = atoi(string_container);
-				arg(argumentFIVE, string_container, NOTEXT);
-				strcpy(line_s.color, string_container);
-				arg(argumentSIX, string_container, NOTEXT);
-				line_s.weight = atoi(string_container);
-				break;
+				line_s.x1 = argNumber(argumentONE);	//collects the information from argument 1
+				line_s.y1 = argNumber(argumentTWO);	//etc
+				line_s.x2 = argNumber(argumentTHREE);
+				line_s.y2 = argNumber(argumentFOUR);
+				line_s.weight = argNumber(argumentSIX);
+				return argName(argumentFIVE, &line_s.color, color_check);
 			}
-			else break;
+			break;
 		case text:	//if the function text is called
 			if(checkFunctionLen(textLen) == false)
 			{
-				arg(argumentONE, string_container, NOTEXT);	//collects the information from argument 1
-				text_s.xlup = atoi(string_container);	//stores the information from argument 1 into text struct
-				arg(argumentTWO, string_container, NOTEXT);	//etc
-				text_s.ylup = atoi(string_container);
-				arg(argumentTHREE, string_container, NOTEXT);
-				strcpy(text_s.color, string_container);
-				arg(argumentFOUR, string_container, YESTEXT);
-				strcpy(text_s.textin, string_container);
-				arg(argumentFIVE, string_container, YESTEXT);
-				strcpy(text_s.fontname, string_container);
-				arg(argumentSIX, string_container, NOTEXT);
-				text_s.fontsize = atoi(string_container);
-				arg(argumentSEVEN, string_container, NOTEXT);
-				strcpy(text_s.fontstyle, string_container);
-				break;
+				text_s.xlup = argNumber(argumentONE);	//collects the information from argument 1
+				text_s.ylup = argNumber(argumentTWO);	//etc
+				argString(argumentFOUR, text_s.textin, sizeof(text_s.textin), YESTEXT);
+				text_s.fontsize = argNumber(argumentSIX);
+				return argName(argumentTHREE, &text_s.color, color_check) &&
+					   argName(argumentFIVE, &text_s.fontname, font_check) &&
+					   argName(argumentSEVEN, &text_s.fontstyle, style_check);
 			}
-			else break;
+			break;
 		case rectangle:	//if the function rectangle is called
 			if(checkFunctionLen(rectangleLen) == false)
 			{
-				arg(argumentONE, string_container, NOTEXT);	//collects the information from argument 1
-				rectangle_s.xlup = atoi(string_container);	//stores the information from argument 1 into rectangle struct
-				arg(argumentTWO, string_container, NOTEXT);
-				rectangle_s.ylup = atoi(string_container);
-				arg(argumentTHREE, string_container, NOTEXT);
-				rectangle_s.width = atoi(string_container);
-				arg(argumentFOUR, string_container, NOTEXT);
-				rectangle_s.height = atoi(string_container);
-				arg(argumentFIVE, string_container, NOTEXT);
-				strcpy(rectangle_s.color, string_container);
-				arg(argumentSIX, string_container, NOTEXT);
-				rectangle_s.filled = atoi(string_container);
-				arg(argumentSEVEN, string_container, NOTEXT);
-				strcpy(rectangle_s.bordercolor, string_container);
-				arg(argumentEIGHT, string_container, NOTEXT);
-				rectangle_s.linewidth = atoi(string_container);
-				break;
+				rectangle_s.xlup = argNumber(argumentONE);	//collects the information from argument 1
+				rectangle_s.ylup = argNumber(argumentTWO);
+				rectangle_s.width = argNumber(argumentTHREE);
+				rectangle_s.height = argNumber(argumentFOUR);
+				rectangle_s.filled = argNumber(argumentSIX);
+				rectangle_s.linewidth = argNumber(argumentEIGHT);
+				return argName(argumentFIVE, &rectangle_s.color, color_check) &&
+					   argName(argumentSEVEN, &rectangle_s.bordercolor, color_check);
 			}
-			else break;
+			break;
 		case bitmap:	//if the function bitmap is called
 			if(checkFunctionLen(bitmapLen) == false)
 			{
-				arg(argumentONE, string_container, NOTEXT);	//collects the information from argument 1
-				bitmap_s.nr = atoi(string_container);	//stores the information from argument 1 into bitmap struct
-				arg(argumentTWO, string_container, NOTEXT);
-				bitmap_s.xlup = atoi(string_container);
-				arg(argumentTHREE, string_container, NOTEXT);
-				bitmap_s.ylup = atoi(string_container);
-				break;
+				bitmap_s.nr = argNumber(argumentONE);	//collects the information from argument 1
+				bitmap_s.xlup = argNumber(argumentTWO);
+				bitmap_s.ylup = argNumber(argumentTHREE);
+				return true;
 			}
-			else break;
+			break;
 		case clearscreen:	//if the function clearscreen is called
 			if(checkFunctionLen(clearscreenLen) == false)
 			{
-				arg(argumentONE, string_container, NOTEXT);	//collects the information from argument 1
-				strcpy(clearscreen_s.color, string_container);	//stores the information from argument 1 into line struct
-				break;
+				return argName(argumentONE, &clearscreen_s.color, color_check);	//collects the information from argument 1
 			}
-			else break;
+			break;
 		default:
-			printf("The function name is not correct");
+			UART_Print("Error: the function name is not correct\n\r");
 			break;
 	}
+	return false;
+}
 
+//--------------------------------------------------------------
+// @brief Function checks a binary frame
+// @details This function checks the length byte and the CRC of the frame in the line.
+//
+// @return true when the frame is complete and undamaged
+//--------------------------------------------------------------
+static bool binCheckFrame(void)
+{
+	if(FL_FrameValid((const uint8_t *)input.line_rx_buffer, input.msglen) == false)
+	{
+		UART_Print("Error: damaged frame\n\r");
+		return false;
+	}
+	return true;
 }
 
 //--------------------------------------------------------------
-// @brief Function reads argument from UART
-// @details This function reads a certain argument from the UART and puts this in a string
+// @brief Function checks the length byte and the CRC of a binary frame
+// @details Also called by the UART interrupt when a frame is complete, see UART_RxFrame.
 //
-// @param[in] a: The variable that determines which argument has to be read
-// @param[in] *string_container: A pointer where the string will be put into
-// @param[in] text_trigger: A boolean that determines if the argument is a text or not
-//--------------------------------------------------------------
-void arg(uint8_t a,char *string_container ,bool text_trigger)
-{
-	uint8_t i = 0;	//counter
-	uint8_t j = 0;	//counter
-	uint8_t arg_counter = 0;	//is needed to check what argument is currently beeing read
-	uint8_t arg_character_counter = 0;	//checks what the current character from the argument is
-	for (j=0; j<input.msglen; j++)	//cleans string container
-	string_container[j] = 0;
-	while(i <= input.msglen)
-			{
-				if(input.line_rx_buffer[i] == ',')	//if current character is a ',' the argument counter goes up
-				{
-					arg_counter++;
-					i++;
-				}
-				else if(input.line_rx_buffer[i] == ' ' && text_trigger == false)	//if its a space it doesnt get read
-				i++;
-				else if(input.line_rx_buffer[i] == ' ' && text_trigger == true && arg_counter == a)	//if its a space but its in a text argument, it gets read
-				{
-					string_container[arg_character_counter++] = input.line_rx_buffer[i++];
-				}
-				else if(arg_counter == a)	//if its a character in the correct argument it gets read
-				string_container[arg_character_counter++] = input.line_rx_buffer[i++];
-				else i++;	//else skips
-			}
+// @param[in] frame: The frame, from binSOF on
+// @param[in] len: The amount of bytes in frame
+//
+// @return true when the frame is complete and undamaged
+//--------------------------------------------------------------
+bool FL_FrameValid(const uint8_t *frame, uint16_t len)
+{
+	return (len >= binHeaderLen + binCrcLen) && (frame[1] == len - binHeaderLen - binCrcLen) &&
+		   (crc16(&frame[1], len - 1 - binCrcLen) == binU16(&frame[len - binCrcLen]));
 }
 
-bool checkFunctionLen(uint8_t functionLen)
+//--------------------------------------------------------------
+// @brief Function load the next function of a binary frame into structs
+// @details The fields have a fixed width, so they are read straight from the frame.
+//
+// @return true when a function is loaded, false at the end of the frame or on an error
+//--------------------------------------------------------------
+static bool binInput(void)
 {
-	uint8_t i = 0;
-	uint8_t arg_counter = 0;
-	bool error = 0;
-	while(i <= input.msglen)
+	const uint8_t *c = (const uint8_t *)&input.line_rx_buffer[flPos];
+	uint16_t left = input.msglen - binCrcLen - flPos;	//bytes of functions left in the frame
+	uint16_t len = 0;
+	uint8_t n;
+
+	if(left == 0)
+		return false;
+
+	switch(c[0])
+	{
+		case binLine:
+			len = 11;
+			if((left < len) || !binColor(c[9], &line_s.color))
+				break;
+			line_s.x1 = binU16(&c[1]);
+			line_s.y1 = binU16(&c[3]);
+			line_s.x2 = binU16(&c[5]);
+			line_s.y2 = binU16(&c[7]);
+			line_s.weight = c[10];
+			fl_function = line;
+			flPos += len;
+			return true;
+		case binRectangle:
+			len = 13;
+			if((left < len) || !binColor(c[9], &rectangle_s.color) || !binColor(c[11], &rectangle_s.bordercolor))
+				break;
+			rectangle_s.xlup = binU16(&c[1]);
+			rectangle_s.ylup = binU16(&c[3]);
+			rectangle_s.width = binU16(&c[5]);
+			rectangle_s.height = binU16(&c[7]);
+			rectangle_s.filled = c[10];
+			rectangle_s.linewidth = c[12];
+			fl_function = rectangle;
+			flPos += len;
+			return true;
+		case binText:
+			len = 10;
+			if((left < len) || (left < len + c[9]) || !binColor(c[5], &text_s.color) ||
+			   (c[6] < ARIAL_FONT) || (c[6] > CONSOLAS_FONT) || (c[8] < NORMAL_STYLE) || (c[8] > CURSIVE_STYLE))
+				break;
+			len += c[9];
+			text_s.xlup = binU16(&c[1]);
+			text_s.ylup = binU16(&c[3]);
+			text_s.fontname = c[6];
+			text_s.fontsize = c[7];
+			text_s.fontstyle = c[8];
+			n = (c[9] < maxTextLen - 1) ? c[9] : maxTextLen - 1;
+			memcpy(text_s.textin, &c[10], n);
+			text_s.textin[n] = '\0';
+			fl_function = text;
+			flPos += len;
+			return true;
+		case binBitmap:
+			len = 7;
+			if(left < len)
+				break;
+			bitmap_s.nr = binU16(&c[1]);
+			bitmap_s.xlup = binU16(&c[3]);
+			bitmap_s.ylup = binU16(&c[5]);
+			fl_function = bitmap;
+			flPos += len;
+			return true;
+		case binClearscreen:
+			len = 2;
+			if((left < len) || !binColor(c[1], &clearscreen_s.color))
+				break;
+			fl_function = clearscreen;
+			flPos += len;
+			return true;
+		case binBegin:
+		case binCommit:
+			len = 1;
+			fl_function = (c[0] == binBegin) ? batchBegin : batchCommit;
+			flPos += len;
+			return true;
+		case binPlay:
+			len = 2;
+			if(left < len)
+				break;
+			macro_s.name[0] = '\0';
+			macro_s.nr = c[1];
+			fl_function = macroPlay;
+			flPos += len;
+			return true;
+		case binMove:
+			len = 6;
+			if(left < len)
+				break;
+			move_s.nr = c[1];
+			move_s.x = (int16_t)binU16(&c[2]);
+			move_s.y = (int16_t)binU16(&c[4]);
+			fl_function = spriteMove;
+			flPos += len;
+			return true;
+		default:
+			break;
+	}
+
+	UART_Print("Error: wrong binary function\n\r");
+	return false;
+}
+
+//--------------------------------------------------------------
+// @brief Function converts a color index of the binary protocol
+//
+// @param[in] index: The index in the color table
+// @param[out] *color: The 8-bit color-code
+//
+// @return false when the index is not in the color table
+//--------------------------------------------------------------
+static bool binColor(uint8_t index, uint8_t *color)
+{
+	if(index >= sizeof(binColors))
+		return false;
+	*color = binColors[index];
+	return true;
+}
+
+//--------------------------------------------------------------
+// @brief Function reads a little-endian 16 bit field
+//--------------------------------------------------------------
+static uint16_t binU16(const uint8_t *c)
+{
+	return c[0] | (c[1] << 8);
+}
+
+//--------------------------------------------------------------
+// @brief Function calculates the CRC-16/CCITT (0x1021, start 0xFFFF) of a frame
+//--------------------------------------------------------------
+static uint16_t crc16(const uint8_t *c, uint16_t len)
+{
+	uint16_t crc = 0xFFFF;
+	uint8_t bit;
+
+	while(len--)
+	{
+		crc ^= *c++ << 8;
+		for(bit = 0; bit < 8; bit++)
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+	}
+	return crc;
+}
+
+//--------------------------------------------------------------
+// @brief Function splits the line into arguments
+// @details This function walks the line once and stores where every argument starts
+//			and how long it is. The arguments are read from the line later, nothing is copied.
+//--------------------------------------------------------------
+static void tokenize(void)
+{
+	uint16_t i;
+	uint16_t start = 0;
+
+	argCount = 0;
+	argRange = false;
+	for(i = 0; i <= input.msglen; i++)
 	{
-		if(input.line_rx_buffer[i] == ',')	//if current character is a ',' the argument counter goes up
+		if((i == input.msglen) || (input.line_rx_buffer[i] == ','))	//end of an argument
+		{
+			if(argCount < maxArguments)
 			{
-				arg_counter++;
-				i++;
+				args[argCount].start = start;
+				args[argCount].len = i - start;
 			}
-		else i++;
+			argCount++;
+			start = i + 1;
+		}
+	}
+}
+
+//--------------------------------------------------------------
+// @brief Function reads a number argument
+// @details This function converts the argument in the line to a number, like atoi
+//			on the argument without spaces would. A number that doesn't fit in an
+//			int32_t stops at INT32_MAX and sets argRange, FL_Input rejects the line then.
+//
+// @param[in] a: The argument that has to be read
+//
+// @return the number, 0 when the argument is missing or doesn't start with a number
+//--------------------------------------------------------------
+static int32_t argNumber(uint8_t a)
+{
+	const char *c;
+	const char *end;
+	int32_t value = 0;
+	bool negative = false;
+
+	if((a >= argCount) || (a >= maxArguments))
+		return 0;
+
+	c = &input.line_rx_buffer[args[a].start];
+	end = c + args[a].len;
+
+	while((c < end) && (*c == ' '))	//spaces don't get read
+		c++;
+	if((c < end) && ((*c == '-') || (*c == '+')))
+		negative = (*c++ == '-');
+	for(; c < end; c++)
+	{
+		if(*c == ' ')
+			continue;
+		if((*c < '0') || (*c > '9'))
+			break;
+		if(value > (INT32_MAX - (*c - '0')) / 10)
+		{
+			argRange = true;
+			value = INT32_MAX;
+			break;
+		}
+		value = (value * 10) + (*c - '0');
+	}
+
+	return negative ? -value : value;
+}
+
+//--------------------------------------------------------------
+// @brief Function reads a string argument
+// @details This function copies the argument from the line into the struct field.
+//			A string that doesn't fit is cut off.
+//
+// @param[in] a: The argument that has to be read
+// @param[in] *dst: The struct field the string will be put into
+// @param[in] size: The size of the struct field
+// @param[in] text_trigger: A boolean that determines if the argument is a text (spaces are kept) or not
+//--------------------------------------------------------------
+static void argString(uint8_t a, char *dst, uint16_t size, bool text_trigger)
+{
+	const char *c;
+	const char *end;
+	uint16_t n = 0;
+
+	if((a < argCount) && (a < maxArguments))
+	{
+		c = &input.line_rx_buffer[args[a].start];
+		end = c + args[a].len;
+		for(; (c < end) && (n < size - 1); c++)
+		{
+			if((*c != ' ') || text_trigger)	//if its a space it doesnt get read, except in a text
+				dst[n++] = *c;
+		}
 	}
+	dst[n] = '\0';
+}
+
+//--------------------------------------------------------------
+// @brief Function reads a color, font or style argument
+// @details This function converts the name in the argument to its code.
+//			The check function reports an unknown name, once.
+//
+// @param[in] a: The argument that has to be read
+// @param[in] *code: The struct field the code will be put into
+// @param[in] check: color_check, font_check or style_check
+//
+// @return false when the name is unknown
+//--------------------------------------------------------------
+static bool argName(uint8_t a, uint8_t *code, int (*check)(const char*))
+{
+	char name[maxFontnameLen];
+	int result;
+
+	argString(a, name, sizeof(name), NOTEXT);
+	result = check(name);
+	if(result < 0)
+		return false;
+	*code = result;
+	return true;
+}
+
+//--------------------------------------------------------------
+// @brief Function checks the amount of arguments
+// @details Uses the amount of arguments found by tokenize, the line is not read again.
+//			Too many arguments give a warning, the extra ones are ignored.
+//
+// @param[in] functionLen: The amount of arguments of the function
+//
+// @return true when there are not enough arguments
+//--------------------------------------------------------------
+static bool checkFunctionLen(uint8_t functionLen)
+{
+	uint16_t arg_counter = argCount - 1;	//the function name is no argument
+	bool error = 0;
+
 	if(arg_counter > functionLen)
 	{
-		HAL_UART_Transmit(&huart2, (uint8_t *)"Warning: the input exceeds the maximum length of this function\n\r", sizeof("Warning: the input exceeds the maximum length of this function"),100);
+		UART_Print("Warning: the input exceeds the maximum length of this function\n\r");
 		error = false;
 	}
 	else if(arg_counter < functionLen)
 	{
-		HAL_UART_Transmit(&huart2, (uint8_t *)"Error: not enough arguments for this function\n\r", sizeof("Error: not enough arguments for this function"),100);
+		UART_Print("Error: not enough arguments for this function\n\r");
 		error = true;
 	}
 	return error;
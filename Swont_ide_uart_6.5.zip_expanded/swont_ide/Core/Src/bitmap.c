@@ -15,1763 +15,1797 @@
 
 //--------------------------------------------------------------
 // generate bitmaps
+// 1 bit per pixel, one byte per 8 pixels of a row, MSB = most left pixel
 //--------------------------------------------------------------
-const uint16_t bitmap_test[] =
+const uint8_t bitmap_1bpp[] =
 {
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@..
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //......@.
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //@.....@.
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //@.....@.
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.@@@@@@@
-
+		  /*Unicode: U+0061 (a) , Width: 8 */
+		  0x00,  //........
+		  0x00,  //........
+		  0x7c,  //.@@@@@..
+		  0x02,  //......@.
+		  0x7e,  //.@@@@@@.
+		  0x82,  //@.....@.
+		  0x82,  //@.....@.
+		  0x7f,  //.@@@@@@@
 
 		  /*Unicode: U+0062 (b) , Width: 8 */
-		  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@......
-		  0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@.@@@@.
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //.@@....@
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //.@.....@
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //.@.....@
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //.@.....@
-		  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@.
-
+		  0xc0,  //@@......
+		  0x40,  //.@......
+		  0x5e,  //.@.@@@@.
+		  0x61,  //.@@....@
+		  0x41,  //.@.....@
+		  0x41,  //.@.....@
+		  0x41,  //.@.....@
+		  0xfe,  //@@@@@@@.
 
 		  /*Unicode: U+0063 (c) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......@
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......@
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......@
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-
+		  0x00,  //........
+		  0x00,  //........
+		  0x7e,  //.@@@@@@.
+		  0x81,  //@......@
+		  0x80,  //@.......
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x7e,  //.@@@@@@.
 
 		  /*Unicode: U+0064 (d) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //.......@
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //.......@
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,  //.@@@@@.@
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@.....@@
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......@
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......@
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@.....@@
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,  //.@@@@@.@
-
+		  0x01,  //.......@
+		  0x01,  //.......@
+		  0x7d,  //.@@@@@.@
+		  0x83,  //@.....@@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x83,  //@.....@@
+		  0x7d,  //.@@@@@.@
 
 		  /*Unicode: U+0065 (e) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......@
-		  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......@
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-
+		  0x00,  //........
+		  0x00,  //........
+		  0x7e,  //.@@@@@@.
+		  0x81,  //@......@
+		  0xff,  //@@@@@@@@
+		  0x80,  //@.......
+		  0x81,  //@......@
+		  0x7e,  //.@@@@@@.
 
 		  /*Unicode: U+0066 (f) , Width: 8 */
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //...@@@@.
-		  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //..@....@
-		  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //..@....@
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@@...
-		  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@.....
-		  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@.....
-		  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@.....
-		  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@...
-
+		  0x1e,  //...@@@@.
+		  0x21,  //..@....@
+		  0x21,  //..@....@
+		  0x78,  //.@@@@...
+		  0x20,  //..@.....
+		  0x20,  //..@.....
+		  0x20,  //..@.....
+		  0xf8,  //@@@@@...
 
 		  /*Unicode: U+0067 (g) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //......@@
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......@
-		  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@.
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@......
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......@
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-
+		  0x03,  //......@@
+		  0x7e,  //.@@@@@@.
+		  0x81,  //@......@
+		  0xfe,  //@@@@@@@.
+		  0x40,  //.@......
+		  0x7e,  //.@@@@@@.
+		  0x81,  //@......@
+		  0x7e,  //.@@@@@@.
 
 		  /*Unicode: U+0068 (h) , Width: 8 */
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.....
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@......
-		  0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@.@@@..
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@@...@.
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@....@.
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@....@.
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@....@.
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@
-
+		  0xe0,  //@@@.....
+		  0x40,  //.@......
+		  0x5c,  //.@.@@@..
+		  0x62,  //.@@...@.
+		  0x42,  //.@....@.
+		  0x42,  //.@....@.
+		  0x42,  //.@....@.
+		  0xe7,  //@@@..@@@
 
 		  /*Unicode: U+0069 (i) , Width: 5 */
-		  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //..@..
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-		  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.@@..
-		  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //..@..
-		  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //..@..
-		  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //..@..
-		  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //..@..
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@@@
-
+		  0x10,  //...@....
+		  0x00,  //........
+		  0x30,  //..@@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x7c,  //.@@@@@..
 
 		  /*Unicode: U+006a (j) , Width: 7 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //......@
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-		  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00,  //....@@@
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //......@
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //......@
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //......@
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //@.....@
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@.
-
+		  0x02,  //......@.
+		  0x00,  //........
+		  0x0e,  //....@@@.
+		  0x02,  //......@.
+		  0x02,  //......@.
+		  0x02,  //......@.
+		  0x82,  //@.....@.
+		  0x7c,  //.@@@@@..
 
 		  /*Unicode: U+006b (k) , Width: 8 */
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.....
-		  0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00,  //.@..@@@.
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //.@...@..
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@@...
-		  0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.@..@...
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //.@...@..
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@....@.
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@
-
+		  0xe0,  //@@@.....
+		  0x4e,  //.@..@@@.
+		  0x44,  //.@...@..
+		  0x78,  //.@@@@...
+		  0x48,  //.@..@...
+		  0x44,  //.@...@..
+		  0x42,  //.@....@.
+		  0xe7,  //@@@..@@@
 
 		  /*Unicode: U+006c (l) , Width: 7 */
-		  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //..@@...
-		  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@...
-		  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@...
-		  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@...
-		  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@...
-		  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@...
-		  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@...
-		  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@
-
+		  0x30,  //..@@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0xfe,  //@@@@@@@.
 
 		  /*Unicode: U+006d (m) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,  //@.@@.@@.
-		  0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //.@..@..@
-		  0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //.@..@..@
-		  0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //.@..@..@
-		  0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //.@..@..@
-		  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,  //@@.@@.@@
-
+		  0x00,  //........
+		  0x00,  //........
+		  0xb6,  //@.@@.@@.
+		  0x49,  //.@..@..@
+		  0x49,  //.@..@..@
+		  0x49,  //.@..@..@
+		  0x49,  //.@..@..@
+		  0xdb,  //@@.@@.@@
 
 		  /*Unicode: U+006e (n) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@.@@@..
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@@...@.
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@....@.
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@....@.
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@....@.
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@
-
+		  0x00,  //........
+		  0x00,  //........
+		  0xdc,  //@@.@@@..
+		  0x62,  //.@@...@.
+		  0x42,  //.@....@.
+		  0x42,  //.@....@.
+		  0x42,  //.@....@.
+		  0xe7,  //@@@..@@@
 
 		  /*Unicode: U+006f (o) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......@
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......@
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......@
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......@
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-
+		  0x00,  //........
+		  0x00,  //........
+		  0x7e,  //.@@@@@@.
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x7e,  //.@@@@@@.
 
 		  /*Unicode: U+0070 (p) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@.
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //.@.....@
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //.@.....@
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //.@.....@
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@......
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.....
-
+		  0x00,  //........
+		  0xfe,  //@@@@@@@.
+		  0x41,  //.@.....@
+		  0x41,  //.@.....@
+		  0x41,  //.@.....@
+		  0x7e,  //.@@@@@@.
+		  0x40,  //.@......
+		  0xe0,  //@@@.....
 
 		  /*Unicode: U+0071 (q) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //@.....@.
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //@.....@.
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //@.....@.
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //......@.
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.....@@@
-
+		  0x00,  //........
+		  0x7e,  //.@@@@@@.
+		  0x82,  //@.....@.
+		  0x82,  //@.....@.
+		  0x82,  //@.....@.
+		  0x7e,  //.@@@@@@.
+		  0x02,  //......@.
+		  0x07,  //.....@@@
 
 		  /*Unicode: U+0072 (r) , Width: 7 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //.......
-		  0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, //@@.@@@.
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, //.@@...@
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, //.@....@
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //.@.....
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //.@.....
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, //@@@....
-
+		  0x00,  //........
+		  0x00,  //........
+		  0xdc,  //@@.@@@..
+		  0x62,  //.@@...@.
+		  0x42,  //.@....@.
+		  0x40,  //.@......
+		  0x40,  //.@......
+		  0xe0,  //@@@.....
 
 		  /*Unicode: U+0073 (s) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //.......@
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......@
-		  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@.
-
+		  0x00,  //........
+		  0x00,  //........
+		  0x7e,  //.@@@@@@.
+		  0x80,  //@.......
+		  0x7e,  //.@@@@@@.
+		  0x01,  //.......@
+		  0x81,  //@......@
+		  0xfe,  //@@@@@@@.
 
 		  /*Unicode: U+0074 (t) , Width: 7 */
-		  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@....
-		  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@....
-		  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@..
-		  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@....
-		  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, //..@....
-		  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, //..@....
-		  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, //..@...@
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, //...@@@.
-
+		  0x20,  //..@.....
+		  0x20,  //..@.....
+		  0xf8,  //@@@@@...
+		  0x20,  //..@.....
+		  0x20,  //..@.....
+		  0x20,  //..@.....
+		  0x22,  //..@...@.
+		  0x1c,  //...@@@..
 
 		  /*Unicode: U+0075 (u) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@....@.
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@....@.
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@....@.
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@....@.
-		  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //..@@@@..
-
+		  0x00,  //........
+		  0x00,  //........
+		  0xe7,  //@@@..@@@
+		  0x42,  //.@....@.
+		  0x42,  //.@....@.
+		  0x42,  //.@....@.
+		  0x42,  //.@....@.
+		  0x3c,  //..@@@@..
 
 		  /*Unicode: U+0076 (v) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@....@.
-		  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //..@..@..
-		  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //..@..@..
-		  0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00,  //...@.@..
-		  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //....@...
-
+		  0x00,  //........
+		  0x00,  //........
+		  0xe7,  //@@@..@@@
+		  0x42,  //.@....@.
+		  0x24,  //..@..@..
+		  0x24,  //..@..@..
+		  0x14,  //...@.@..
+		  0x08,  //....@...
 
 		  /*Unicode: U+0077 (w) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@....@.
-		  0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,  //.@.@..@.
-		  0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,  //.@.@..@.
-		  0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,  //.@.@..@.
-		  0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //..@.@@..
-
+		  0x00,  //........
+		  0x00,  //........
+		  0xe7,  //@@@..@@@
+		  0x42,  //.@....@.
+		  0x52,  //.@.@..@.
+		  0x52,  //.@.@..@.
+		  0x52,  //.@.@..@.
+		  0x2c,  //..@.@@..
 
 		  /*Unicode: U+0078 (x) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@
-		  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //..@..@..
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-		  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //..@..@..
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@....@.
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@
-
+		  0x00,  //........
+		  0x00,  //........
+		  0xe7,  //@@@..@@@
+		  0x24,  //..@..@..
+		  0x18,  //...@@...
+		  0x24,  //..@..@..
+		  0x42,  //.@....@.
+		  0xe7,  //@@@..@@@
 
 		  /*Unicode: U+0079 (y) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@....@.
-		  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.@....@.
-		  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //..@@@@@.
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //@.....@.
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@..
-
+		  0x00,  //........
+		  0x00,  //........
+		  0xe7,  //@@@..@@@
+		  0x42,  //.@....@.
+		  0x42,  //.@....@.
+		  0x3e,  //..@@@@@.
+		  0x82,  //@.....@.
+		  0x7c,  //.@@@@@..
 
 		  /*Unicode: U+007a (z) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......@
-		  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00,  //....@@@.
-		  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.@@@....
-		  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......@
-		  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
+		  0x00,  //........
+		  0x00,  //........
+		  0xff,  //@@@@@@@@
+		  0x81,  //@......@
+		  0x0e,  //....@@@.
+		  0x70,  //.@@@....
+		  0x81,  //@......@
+		  0xff,  //@@@@@@@@
 
 		  /*Unicode: U+0061 (a) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@@...
-		  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //....@@..
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@..
-		  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //@@..@@..
-		  0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,  //.@@@.@@.
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+		  0x00,  //........
+		  0x00,  //........
+		  0x78,  //.@@@@...
+		  0x0c,  //....@@..
+		  0x7c,  //.@@@@@..
+		  0xcc,  //@@..@@..
+		  0x76,  //.@@@.@@.
+		  0x00,  //........
 
 		  /*Unicode: U+0062 (b) , Width: 8 */
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.....
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@.....
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@.....
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@..
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@..@@.
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@..@@.
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@..
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+		  0xe0,  //@@@.....
+		  0x60,  //.@@.....
+		  0x60,  //.@@.....
+		  0x7c,  //.@@@@@..
+		  0x66,  //.@@..@@.
+		  0x66,  //.@@..@@.
+		  0x7c,  //.@@@@@..
+		  0x00,  //........
 
 		  /*Unicode: U+0063 (c) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@..
-		  0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //@@...@@.
-		  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-		  0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //@@...@@.
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@..
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+		  0x00,  //........
+		  0x00,  //........
+		  0x7c,  //.@@@@@..
+		  0xc6,  //@@...@@.
+		  0xc0,  //@@......
+		  0xc6,  //@@...@@.
+		  0x7c,  //.@@@@@..
+		  0x00,  //........
 
 		  /*Unicode: U+0064 (d) , Width: 8 */
-		  0x00, 0x00, 0x00, 0xFF, 0xff, 0xff, 0x00, 0x00,  //...@@@..
-		  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //....@@..
-		  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //....@@..
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@..
-		  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //@@..@@..
-		  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //@@..@@..
-		  0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,  //.@@@.@@.
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+		  0x1c,  //...@@@..
+		  0x0c,  //....@@..
+		  0x0c,  //....@@..
+		  0x7c,  //.@@@@@..
+		  0xcc,  //@@..@@..
+		  0xcc,  //@@..@@..
+		  0x76,  //.@@@.@@.
+		  0x00,  //........
 
 		  /*Unicode: U+0065 (e) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@..
-		  0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //@@...@@.
-		  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@.
-		  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@..
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+		  0x00,  //........
+		  0x00,  //........
+		  0x7c,  //.@@@@@..
+		  0xc6,  //@@...@@.
+		  0xfe,  //@@@@@@@.
+		  0xc0,  //@@......
+		  0x7c,  //.@@@@@..
+		  0x00,  //........
 
 		  /*Unicode: U+0066 (f) , Width: 7 */
-		  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@@..
-		  0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //.@@.@@.
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@....
-		  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //@@@@...
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@....
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@....
-		  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //@@@@...
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+		  0x38,  //..@@@...
+		  0x6c,  //.@@.@@..
+		  0x60,  //.@@.....
+		  0xf0,  //@@@@....
+		  0x60,  //.@@.....
+		  0x60,  //.@@.....
+		  0xf0,  //@@@@....
+		  0x00,  //........
 
 		  /*Unicode: U+0067 (g) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,  //.@@@.@@.
-		  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //@@..@@..
-		  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //@@..@@..
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@..
-		  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //....@@..
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@@...
-
+		  0x00,  //........
+		  0x00,  //........
+		  0x76,  //.@@@.@@.
+		  0xcc,  //@@..@@..
+		  0xcc,  //@@..@@..
+		  0x7c,  //.@@@@@..
+		  0x0c,  //....@@..
+		  0x78,  //.@@@@...
 
 		  /*Unicode: U+0068 (h) , Width: 8 */
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.....
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@.....
-		  0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //.@@.@@..
-		  0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,  //.@@@.@@.
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@..@@.
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@..@@.
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //@@@..@@.
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+		  0xe0,  //@@@.....
+		  0x60,  //.@@.....
+		  0x6c,  //.@@.@@..
+		  0x76,  //.@@@.@@.
+		  0x66,  //.@@..@@.
+		  0x66,  //.@@..@@.
+		  0xe6,  //@@@..@@.
+		  0x00,  //........
 
 		  /*Unicode: U+0069 (i) , Width: 4 */
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@.
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-		  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@.
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@.
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@.
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@.
-		  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@@
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
+		  0x18,  //...@@...
+		  0x00,  //........
+		  0x38,  //..@@@...
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+		  0x3c,  //..@@@@..
+		  0x00,  //........
 
 		  /*Unicode: U+006a (j) , Width: 7 */
-		  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //....@@.
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-		  0x00, 0x00, 0x00, 0xFF, 0xff, 0xff, 0x00, 0x00,  //...@@@.
-		  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //....@@.
-		  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //....@@.
-		  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //....@@.
-		  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //@@..@@.
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@@..
-
+		  0x0c,  //....@@..
+		  0x00,  //........
+		  0x1c,  //...@@@..
+		  0x0c,  //....@@..
+		  0x0c,  //....@@..
+		  0x0c,  //....@@..
+		  0xcc,  //@@..@@..
+		  0x78,  //.@@@@...
 
 		  /*Unicode: U+006b (k) , Width: 8 */
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.....
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@.....
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@..@@.
-		  0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //.@@.@@..
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@@...
-		  0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //.@@.@@..
-		  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //@@@..@@.
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+		  0xe0,  //@@@.....
+		  0x60,  //.@@.....
+		  0x66,  //.@@..@@.
+		  0x6c,  //.@@.@@..
+		  0x78,  //.@@@@...
+		  0x6c,  //.@@.@@..
+		  0xe6,  //@@@..@@.
+		  0x00,  //........
 
 		  /*Unicode: U+006c (l) , Width: 4 */
-		  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@.
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@.
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@.
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@.
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@.
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@.
-		  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@@
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
+		  0x38,  //..@@@...
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+		  0x3c,  //..@@@@..
+		  0x00,  //........
 
 		  /*Unicode: U+006d (m) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //@@..@@..
-		  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@.
-		  0xff, 0xff, 0x00, 0xFF, 0x00, 0xff, 0xff, 0x00,  //@@.@.@@.
-		  0xff, 0xff, 0x00, 0xFF, 0x00, 0xff, 0xff, 0x00,  //@@.@.@@.
-		  0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //@@...@@.
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+		  0x00,  //........
+		  0x00,  //........
+		  0xcc,  //@@..@@..
+		  0xfe,  //@@@@@@@.
+		  0xd6,  //@@.@.@@.
+		  0xd6,  //@@.@.@@.
+		  0xc6,  //@@...@@.
+		  0x00,  //........
 
 		  /*Unicode: U+006e (n) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@.@@@..
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@..@@.
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@..@@.
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@..@@.
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@..@@.
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+		  0x00,  //........
+		  0x00,  //........
+		  0xdc,  //@@.@@@..
+		  0x66,  //.@@..@@.
+		  0x66,  //.@@..@@.
+		  0x66,  //.@@..@@.
+		  0x66,  //.@@..@@.
+		  0x00,  //........
 
 		  /*Unicode: U+006f (o) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@..
-		  0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //@@...@@.
-		  0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //@@...@@.
-		  0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //@@...@@.
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@..
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+		  0x00,  //........
+		  0x00,  //........
+		  0x7c,  //.@@@@@..
+		  0xc6,  //@@...@@.
+		  0xc6,  //@@...@@.
+		  0xc6,  //@@...@@.
+		  0x7c,  //.@@@@@..
+		  0x00,  //........
 
 		  /*Unicode: U+0070 (p) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@.@@@..
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@..@@.
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@..@@.
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@..
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@.....
-		  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //@@@@....
-
+		  0x00,  //........
+		  0x00,  //........
+		  0xdc,  //@@.@@@..
+		  0x66,  //.@@..@@.
+		  0x66,  //.@@..@@.
+		  0x7c,  //.@@@@@..
+		  0x60,  //.@@.....
+		  0xf0,  //@@@@....
 
 		  /*Unicode: U+0071 (q) , Width: 7 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-		  0x00, 0xFF, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@.
-		  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //@@..@@.
-		  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //@@..@@.
-		  0x00, 0xFF, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@.
-		  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //....@@.
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //...@@@@
-
+		  0x00,  //........
+		  0x00,  //........
+		  0x7c,  //.@@@@@..
+		  0xcc,  //@@..@@..
+		  0xcc,  //@@..@@..
+		  0x7c,  //.@@@@@..
+		  0x0c,  //....@@..
+		  0x1e,  //...@@@@.
 
 		  /*Unicode: U+0072 (r) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@.@@@@.
-		  0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,  //.@@@.@@.
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@.....
-		  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@.....
-		  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //@@@@....
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+		  0x00,  //........
+		  0x00,  //........
+		  0xde,  //@@.@@@@.
+		  0x76,  //.@@@.@@.
+		  0x60,  //.@@.....
+		  0x60,  //.@@.....
+		  0xf0,  //@@@@....
+		  0x00,  //........
 
 		  /*Unicode: U+0073 (s) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@..
-		  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@..
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //.....@@.
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@..
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+		  0x00,  //........
+		  0x00,  //........
+		  0x7c,  //.@@@@@..
+		  0xc0,  //@@......
+		  0x7c,  //.@@@@@..
+		  0x06,  //.....@@.
+		  0x7c,  //.@@@@@..
+		  0x00,  //........
 
 		  /*Unicode: U+0074 (t) , Width: 6 */
-		  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,  //...@..
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@..
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF, 0x00,  //@@@@@@
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@..
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@..
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xFF, 0x00,  //..@@.%
-		  0x00, 0x00, 0x00, 0x00, 0xFF, 0xff, 0x00, 0x00,  //...@@.
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+		  0x08,  //....@...
+		  0x18,  //...@@...
+		  0x7e,  //.@@@@@@.
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+		  0x1a,  //...@@.@.
+		  0x0c,  //....@@..
+		  0x00,  //........
 
 		  /*Unicode: U+0075 (u) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //@@..@@..
-		  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //@@..@@..
-		  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //@@..@@..
-		  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //@@..@@..
-		  0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,  //.@@@.@@.
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+		  0x00,  //........
+		  0x00,  //........
+		  0xcc,  //@@..@@..
+		  0xcc,  //@@..@@..
+		  0xcc,  //@@..@@..
+		  0xcc,  //@@..@@..
+		  0x76,  //.@@@.@@.
+		  0x00,  //........
 
 		  /*Unicode: U+0076 (v) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0xff, 0xff, 0x00, 0x00, 0x00, 0xFF, 0xff, 0x00,  //@@...%@%
-		  0xff, 0xff, 0x00, 0x00, 0x00, 0xFF, 0xff, 0x00,  //@@...%@%
-		  0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //.@@.@@..
-		  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@@...
-		  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,  //...@....
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+		  0x00,  //........
+		  0x00,  //........
+		  0xc6,  //@@...@@.
+		  0xc6,  //@@...@@.
+		  0x6c,  //.@@.@@..
+		  0x38,  //..@@@...
+		  0x10,  //...@....
+		  0x00,  //........
 
 		  /*Unicode: U+0077 (w) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //@@...@@.
-		  0xff, 0xff, 0x00, 0xFF, 0x00, 0xff, 0xff, 0x00,  //@@.@.@@.
-		  0xff, 0xff, 0x00, 0xFF, 0x00, 0xff, 0xff, 0x00,  //@@.@.@@.
-		  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@.
-		  0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //.@@.@@..
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+		  0x00,  //........
+		  0x00,  //........
+		  0xc6,  //@@...@@.
+		  0xd6,  //@@.@.@@.
+		  0xd6,  //@@.@.@@.
+		  0xfe,  //@@@@@@@.
+		  0x6c,  //.@@.@@..
+		  0x00,  //........
 
 		  /*Unicode: U+0078 (x) , Width: 8 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-		  0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //@@...@@.
-		  0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //.@@.@@..
-		  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@@...
-		  0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //.@@.@@..
-		  0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //@@...@@.
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+		  0x00,  //........
+		  0x00,  //........
+		  0xc6,  //@@...@@.
+		  0x6c,  //.@@.@@..
+		  0x38,  //..@@@...
+		  0x6c,  //.@@.@@..
+		  0xc6,  //@@...@@.
+		  0x00,  //........
 
 		  /*Unicode: U+0079 (y) , Width: 7 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-		  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //@@..@@.
-		  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //@@..@@.
-		  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //@@..@@.
-		  0x00, 0xFF, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@.
-		  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //....@@.
-		  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@..
-
+		  0x00,  //........
+		  0x00,  //........
+		  0xcc,  //@@..@@..
+		  0xcc,  //@@..@@..
+		  0xcc,  //@@..@@..
+		  0x7c,  //.@@@@@..
+		  0x0c,  //....@@..
+		  0xf8,  //@@@@@...
 
 		  /*Unicode: U+007a (z) , Width: 6 */
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF, 0x00,  //@@@@@@
-		  0x00, 0xFF, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //@..@@.
-		  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@..
-		  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xFF, 0x00,  //.@@..@
-		  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF, 0x00,  //@@@@@@
-		  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
+		  0x00,  //........
+		  0x00,  //........
+		  0x7e,  //.@@@@@@.
+		  0x4c,  //.@..@@..
+		  0x18,  //...@@...
+		  0x32,  //..@@..@.
+		  0x7e,  //.@@@@@@.
+		  0x00,  //........
 
 		  /*Unicode: U+0041 (A) , Width: 8 */
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@%%%%%%@
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@%%%%%%@
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0042 (B) , Width: 8 */
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@%%%%%%@
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //@.....+.
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1a,  //@%%%%%@.
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@%%%%%%.
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0043 (C) , Width: 8 */
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@%%%%%%@
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xFF, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //+%%%%%%+
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0044 (D) , Width: 8 */
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@%%%%%%@
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@%%%%%%.
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0045 (E) , Width: 8 */
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@%%%%%%%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0xff, 0xff, 0xff, 0xFF, 0x00, 0x00, 0x00,  //@%%%%...
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%%%%%%%
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0046 (F) , Width: 8 */
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@%%%%%%%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0xff, 0xff, 0xff, 0xFF, 0x00, 0x00, 0x00,  //@%%%%...
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0047 (G) , Width: 8 */
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //%%%%%%%%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //@..%%%%.
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.%%%%%%.
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0048 (H) , Width: 8 */
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@%%%%%%@
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0049 (I) , Width: 8 */
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //%%%@%%%%
-		    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@....
-		    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@....
-		    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@....
-		    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@....
-		    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@....
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //%%%@%%%%
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+004a (J) , Width: 8 */
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //%%%%%%%@
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //.......%
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //.......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.%%%%%%.
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+004b (K) , Width: 8 */
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //@....++.
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@%%%%@+.
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //@.....+.
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+004c (L) , Width: 8 */
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%%%%%%%
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+004d (M) , Width: 8 */
-		    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@%%..%%@
-		    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,  //@..%%..%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+004e (N) , Width: 8 */
-		    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@%.....%
-		    0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@.+....%
-		    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,  //@.+%...%
-		    0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //@...%..%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff,  //@....+.%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@....+%@
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+004f (O) , Width: 8 */
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@%%%%%%@
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.%%%%%%.
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0050 (P) , Width: 8 */
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@%%%%%%@
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@%%%%%%.
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0051 (Q) , Width: 8 */
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@%%%%%%@
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@.....+%
-			0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //%....%%.
-		    0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,  //.%%%%..%
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0052 (R) , Width: 8 */
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@%%%%%%@
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@.....+.
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@%%%%%+.
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //@.....+.
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0053 (S) , Width: 8 */
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@%%%%%%%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.......
-		    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.%%%%%%.
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //.......%
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //.......%
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //%%%%%%%.
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0054 (T) , Width: 8 */
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //%%%@%%%%
-		    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@....
-		    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@....
-		    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@....
-		    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@....
-		    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@....
-		    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@....
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0055 (U) , Width: 8 */
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.%%%%%%.
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0056 (V) , Width: 8 */
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.%+..+%.
-		    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..+%%+..
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0057 (W) , Width: 8 */
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,  //@.+%%+.%
-		    0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.%+..+%.
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0058 (X) , Width: 8 */
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@%....+@
-		    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //..%%%%+.
-		    0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.+....+.
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+0059 (Y) , Width: 8 */
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-		    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //@......%
-			0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //@%+..+%@
-		    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //..+%@+..
-		    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //....%...
-		    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //....%...
-		    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //....%...
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-		    /*Unicode: U+005a (Z) , Width: 8 */
-		    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //%%%%%%@+
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //.....%+.
-		    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //....%...
-		    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //...%....
-		    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%.....
-			0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+......
-			0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@%%%%%+
-		    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-			/*Unicode: U+0041 (A) , Width: 8 */
-			0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,  //........
-			0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF,  //@@@@@@@%
-			0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@@++++@%
-			0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@@++++@%
-			0xff, 0xff, 0xff, 0xff, 0xFF, 0xff, 0xff, 0xFF,  //@@@@@@@%
-			0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xff, 0xFF,  //@%....@%
-			0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-
-
-			  /*Unicode: U+0042 (B) , Width: 8 */
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //........
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF,  //@@@@@@@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@@++++@%
-			  0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,  //@@++++@.
-			  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@@@@@@@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xff, 0xFF,  //@@++++@%
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@%.
-
-
-			  /*Unicode: U+0043 (C) , Width: 8 */
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //........
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //%@@@@@@.
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@@++++@+
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@%......
-			  0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xff, 0xFF,  //@@++++@+
-			  0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //%@@@@@@.
-
-
-			  /*Unicode: U+0044 (D) , Width: 8 */
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //........
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF,  //@@@@@@@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@@++++@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xff, 0xFF,  //@@++++@%
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@%.
-
-
-			  /*Unicode: U+0045 (E) , Width: 8 */
-			  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  //........
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF,  //@@@@@@@+
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+++++.
-			  0xff, 0xFF, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@++....
-			  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@+...
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......
-			  0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,  //@@+++++.
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF,  //.@@@@@@+
-
-
-			  /*Unicode: U+0046 (F) , Width: 8 */
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //........
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@+
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+++++.
-			  0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,  //@@++....
-			  0xff, 0xff, 0xff, 0xff, 0xFF, 0x00, 0x00, 0x00,  //@@@@+...
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......
-
-
-			  /*Unicode: U+0047 (G) , Width: 8 */
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //........
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF,  //@@@@@@@%
-			  0xff, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@++++++
-			  0xff, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xff, 0xFF,  //@%.++++.
-			  0xff, 0xFF, 0x00, 0x00, 0xff, 0xff, 0xff, 0xFF,  //@%.@@@@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xff, 0xFF,  //@@++++@%
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@%.
-
-
-			  /*Unicode: U+0048 (H) , Width: 8 */
-			  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,  //........
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xff, 0xFF,  //@@++++@%
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF,  //@@@@@@@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-
-
-			  /*Unicode: U+0049 (I) , Width: 8 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-			  0xFF, 0xFF, 0xFF, 0xff, 0xFF, 0xFF, 0xFF, 0xFF,  //+++@@+++
-			  0x00, 0x00, 0x00, 0xff, 0xFF, 0x00, 0x00, 0x00,  //...@%...
-			  0x00, 0x00, 0x00, 0xff, 0xFF, 0x00, 0x00, 0x00,  //...@%...
-			  0x00, 0x00, 0x00, 0xff, 0xFF, 0x00, 0x00, 0x00,  //...@%...
-			  0xFF, 0xFF, 0xFF, 0xff, 0xFF, 0xFF, 0xFF, 0xFF,  //+++@@+++
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-
-
-			  /*Unicode: U+004a (J) , Width: 8 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF,  //@@@@@@@%
-			  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xff, 0xFF,  //++++++@%
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //......@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xff, 0xFF,  //@@++++@%
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@%.
-
-
-			  /*Unicode: U+004b (K) , Width: 8 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xff, 0xff, 0xff,  //@@+++@@%
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@%.
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0xbc, 0xff, 0xFF,  //@%...%@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-
-
-			  /*Unicode: U+004c (L) , Width: 8 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......
-			  0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,  //@@+++++.
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF,  //.@@@@@@+
-
-
-			  /*Unicode: U+004d (M) , Width: 8 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF,  //@@@@@@@%
-			  0xff, 0xFF, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF,  //@@@@@%@%
-			  0xff, 0xFF, 0x00, 0xff, 0xff, 0x00, 0xff, 0xFF,  //@%.@%.@%
-			  0xff, 0xFF, 0x00, 0xff, 0xFF, 0x00, 0xff, 0xFF,  //@%.@%.@%
-			  0xff, 0xFF, 0x00, 0xff, 0xFF, 0x00, 0xff, 0xFF,  //@%.@%.@%
-			  0xff, 0xFF, 0x00, 0xff, 0xFF, 0x00, 0xff, 0xFF,  //@%.@%.@%
-			  0xff, 0xFF, 0x00, 0xff, 0xFF, 0x00, 0xff, 0xFF,  //@%.@%.@%
-
-
-			  /*Unicode: U+004e (N) , Width: 8 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-			  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@@+...@%
-			  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@@@...@%
-			  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xFF,  //@%@@..@%
-			  0xff, 0xFF, 0xff, 0xff, 0xff, 0x00, 0xff, 0xFF,  //@%.@@.@%
-			  0xff, 0xFF, 0x00, 0xff, 0xff, 0xff, 0xff, 0xFF,  //@%..@@@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0xff, 0xff, 0xFF,  //@%...@@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-
-
-			  /*Unicode: U+004f (O) , Width: 8 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@%
-			  0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xff, 0xFF,  //@@++++@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xff, 0xFF,  //@@++++@%
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@%.
-
-
-			  /*Unicode: U+0050 (P) , Width: 8 */
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //........
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF,  //@@@@@@@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@@++++@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@++++@%
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@%.
-			  0xff, 0xFF, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@%......
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......
-
-
-			  /*Unicode: U+0051 (Q) , Width: 8 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@%.
-			  0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xff, 0xFF,  //@@++++@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //@%...@@+
-			  0xff, 0xFF, 0xFF, 0xFF, 0xff, 0xff, 0xff, 0xff,  //@@++%@@+
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xFF,  //+@@@@+@%
-
-
-			  /*Unicode: U+0052 (R) , Width: 8 */
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //........
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@@++++@%
-			  0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xff, 0xFF,  //@@++++@%
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF, 0x00,  //@@@@@@%.
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0xff, 0xff, 0xFF,  //@%...%@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-
-
-			  /*Unicode: U+0053 (S) , Width: 8 */
-			  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  //........
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF,  //@@@@@@@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@++++++
-			  0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xff, 0x00,  //@@+++++.
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF,  //.@@@@@@%
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //......@%
-			  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xff, 0xFF,  //++++++@%
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@%.
-
-
-			  /*Unicode: U+0054 (T) , Width: 8 */
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //........
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-			  0x00, 0x00, 0x00, 0xff, 0xFF, 0x00, 0x00, 0x00,  //+++@@+++
-			  0x00, 0x00, 0x00, 0xff, 0xFF, 0x00, 0x00, 0x00,  //...@%...
-			  0x00, 0x00, 0x00, 0xff, 0xFF, 0x00, 0x00, 0x00,  //...@%...
-			  0x00, 0x00, 0x00, 0xff, 0xFF, 0x00, 0x00, 0x00,  //...@%...
-			  0x00, 0x00, 0x00, 0xff, 0xFF, 0x00, 0x00, 0x00,  //...@%...
-			  0x00, 0x00, 0x00, 0xff, 0xFF, 0x00, 0x00, 0x00,  //...@%...
-
-
-			  /*Unicode: U+0055 (U) , Width: 8 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xff, 0xFF,  //@@++++@%
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@%.
-
-
-			  /*Unicode: U+0056 (V) , Width: 8 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xFF,  //@@+..@@%
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@%%@%.
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //..@@@+..
-
-
-			  /*Unicode: U+0057 (W) , Width: 8 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0xff, 0xFF, 0x00, 0xff, 0xFF,  //@%.@%.@%
-			  0xff, 0xFF, 0x00, 0xff, 0xFF, 0x00, 0xff, 0xFF,  //@%.@%.@%
-			  0xff, 0xFF, 0x00, 0xff, 0xff, 0x00, 0xff, 0xFF,  //@%.@%.@%
-			  0xff, 0xFF, 0xff, 0xff, 0xff, 0xff, 0xff, 0xFF,  //@@@@@%@%
-			  0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,  //.@@.+@%.
-
-
-			  /*Unicode: U+0058 (X) , Width: 8 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xff, 0xff, 0xFF, 0xFF, 0xff, 0xff, 0xff,  //@@%++@@%
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-			  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xFF,  //@@+..%@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-
-
-			  /*Unicode: U+0059 (Y) , Width: 8 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xff, 0xFF,  //@%....@%
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@%
-			  0x00, 0xFF, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.+@@@%+.
-			  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@%...
-			  0x00, 0x00, 0x00, 0xff, 0xFF, 0x00, 0x00, 0x00,  //...@%...
-			  0x00, 0x00, 0x00, 0xff, 0xFF, 0x00, 0x00, 0x00,  //...@%...
-
-
-			  /*Unicode: U+005a (Z) , Width: 8 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-			  0xFF, 0xFF, 0xFF, 0xFF, 0xff, 0xff, 0xff, 0xFF,  //++++%@@%
-			  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00,  //....@@+.
-			  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..+@@...
-			  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.%@@....
-			  0xFF, 0xff, 0xff, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  //%@@%++++
-			  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-
-			  /*Unicode: U+0041 (A) , Width: 5 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-			  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..%%.
-			  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..%%.
-			  0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00,  //.%.%.
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //+@@@.
-			  0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //%..+.
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
-
-			    /*Unicode: U+0042 (B) , Width: 5 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.%@@+
-			  0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //.%.++
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@.
-			  0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //++.++
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //%@@@.
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
-
-			    /*Unicode: U+0043 (C) , Width: 6 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //..@@+.
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //.@..%.
-			  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //++....
-			  0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //+%.+%.
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.%@@..
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
-
-			    /*Unicode: U+0044 (D) , Width: 5 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.%@@+
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //.%..@
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //.+..%
-			  0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //+..+%
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //%@@%.
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
-
-			    /*Unicode: U+0045 (E) , Width: 5 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.%@@@
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%...
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@+
-			  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //++...
-			  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //%@@@.
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
-
-			    /*Unicode: U+0046 (F) , Width: 5 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.%@@%
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%...
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@.
-			  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //++...
-			  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%....
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
-
-			    /*Unicode: U+0047 (G) , Width: 6 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //..@@%.
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@..%.
-			  0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //.+.@@.
-			  0x00, 0x00, 0xff, 0x0a, 0x00, 0xff, 0x00, 0x00,  //.%..%.
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0x34, 0x00, 0x00,  //.%@@..
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
-
-			    /*Unicode: U+0048 (H) , Width: 6 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //.%..%.
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //.%..%.
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@.
-			  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //++..%.
-			  0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //%..++.
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
-
-			    /*Unicode: U+0049 (I) , Width: 3 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...
-			  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //.%.
-			  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //.%.
-			  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //.%.
-			  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //++.
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //+..
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...
-
-
-			    /*Unicode: U+004a (J) , Width: 4 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //...%
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //...+
-			  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //..+.
-			  0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00,  //%.%.
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //+@%.
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+004b (K) , Width: 6 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //.%.+%.
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.%++..
-			  0x00, 0x28, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.@@...
-			  0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00,  //++.%..
-			  0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //%..++.
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
-
-			    /*Unicode: U+004c (L) , Width: 4 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-			  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //.%..
-			  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //.%..
-			  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //.+..
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //+...
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //%@@%
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+004d (M) , Width: 7 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //.%...@.
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.%+.%%.
-			  0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00,  //.+%.%%.
-			  0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00,  //++%%++.
-			  0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x00, 0x00,  //%.%++..
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
-
-			    /*Unicode: U+004e (N) , Width: 6 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0xff, 0x46, 0x00, 0xff, 0x00, 0x00,  //.%+.+.
-			  0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00,  //.%%.%.
-			  0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00,  //.%+.%.
-			  0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //++.%%.
-			  0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //%..%+.
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
-
-			    /*Unicode: U+004f (O) , Width: 6 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.+@@%.
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@..%+
-			  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //++..++
-			  0x00, 0x00, 0xff, 0x0e, 0x00, 0xff, 0x00, 0x00,  //.%..@.
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.%@@+.
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
-
-			    /*Unicode: U+0050 (P) , Width: 5 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-			  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@%
-			  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,  //.%..%
-			  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@+
-			  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //++...
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //%....
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
-
-			    /*Unicode: U+0051 (Q) , Width: 6 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.+@@%.
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@..%+
-			  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //++..++
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //.%.%%.
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.%@@%.
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //....+.
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
-
-			    /*Unicode: U+0052 (R) , Width: 6 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.%@@%.
-			  0x00, 0x00, 0xff, 0x00, 0x08, 0xff, 0x00, 0x00,  //.%..%.
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@%.
-			  0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00,  //++.%..
-			  0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //%...%.
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
-
-			    /*Unicode: U+0053 (S) , Width: 5 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.+@@+
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%...
-			  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //..%%.
-			  0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //++.%+
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@%.
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
-
-			    /*Unicode: U+0054 (T) , Width: 5 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@
-			  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //..%..
-			  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //..%..
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%..
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.++..
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
-
-			    /*Unicode: U+0055 (U) , Width: 6 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //.%..+.
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //.%..%.
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //.%..%.
-			  0x00, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0x00,  //++.+%.
-			  0x00, 0x0e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.%@%..
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
-
-			    /*Unicode: U+0056 (V) , Width: 6 */
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x08, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //.%..%.
-			  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //.%..+.
-			  0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00,  //.%.%..
-			  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.+++..
-			  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.+%...
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-			  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
-
-			    /*Unicode: U+0057 (W) , Width: 8 */
-			    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-				0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00,  //.%.+%.+.
-				0x00, 0xff, 0x0a, 0xff, 0xff, 0x00, 0xff, 0x00,  //.%.%%.%.
-			    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //.%+.%%..
-			    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //.%%.%%..
-			    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.@..@...
-			    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-			    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
-
-			    /*Unicode: U+0058 (X) , Width: 6 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-				0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //.%..%.
-				0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.++%..
-				0x00, 0x00, 0x0e, 0xff, 0x00, 0x00, 0x00, 0x00,  //..@...
-				0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.%++..
-				0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //%..%..
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
-
-			    /*Unicode: U+0059 (Y) , Width: 6 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-				0x00, 0x08, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //.%..%.
-				0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //.%.++.
-				0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..%%..
-				0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //..%...
-				0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //..%...
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
-
-			    /*Unicode: U+005a (Z) , Width: 5 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-				0x00, 0x0e, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@+
-				0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //...@.
-				0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //..%..
-				0x00, 0x00, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00,  //.+...
-				0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, //+@@@.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
-
-			    /*Unicode: U+0061 (a) , Width: 4 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //.@@+
-				0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.%%%
-				0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //%+%+
-				0x00, 0x00, 0x6a, 0xff, 0xff, 0xff, 0x00, 0x00,  //+@@+
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+0062 (b) , Width: 4 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //.%..
-				0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@+
-				0x00, 0x00, 0x3c, 0xff, 0x00, 0xff, 0x00, 0x00,  //.%.%
-				0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //+.+%
-				0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //%@@.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+0063 (c) , Width: 4 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@+
-				0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //++..
-				0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //%...
-				0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //+@@.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+0064 (d) , Width: 5 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-				0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0x00, 0x00,  //...%.
-				0x00, 0x0c, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@%.
-				0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00,  //++.%.
-				0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //%.++.
-				0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //+@@..
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
-
-			    /*Unicode: U+0065 (e) , Width: 4 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //....
-				0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00,  //.%@+
-				0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //+@@%
-				0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //%...
-				0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+0066 (f) , Width: 3 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...
-				0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.%@
-				0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //%@+
-				0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.+.
-				0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //++.
-				0x00, 0x00, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00,  //%..
-				0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //...
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...
-
-
-			    /*Unicode: U+0067 (g) , Width: 4 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //....
-				0x00, 0x00, 0x0e, 0xff, 0x00, 0xff, 0x00, 0x00,  //.@@%
-				0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //++.%
-				0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //%.++
-				0x00, 0x00, 0xff, 0x0e, 0xff, 0x00, 0x00, 0x00,  //+@@+
-				0x00, 0x00, 0x0e, 0xff, 0x00, 0x00, 0x00, 0x00,  //%@%.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+0068 (h) , Width: 4 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //.%..
-				0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@+
-				0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00,  //.%.%
-				0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //+..+
-				0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00,  //%.+.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+0069 (i) , Width: 2 */
-				0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //..
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%
-				0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.+
-				0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //++
-				0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //%.
-				0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //%.
-				0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //..
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..
-
-
-			    /*Unicode: U+006a (j) , Width: 2 */
-				0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //..
-				0x00, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00,  //.%
-				0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.+
-				0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //++
-				0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //%.
-				0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //%.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..
-
-
-			    /*Unicode: U+006b (k) , Width: 4 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //.%..
-				0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00,  //.%++
-				0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.%%.
-				0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //++%.
-				0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00,  //%.%.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+006c (l) , Width: 2 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..
-				0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.%
-				0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.%
-				0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //++
-				0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //+.
-				0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //%.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..
-
-
-			    /*Unicode: U+006d (m) , Width: 6 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-				0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.%@%@+
-				0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,  //+%.%.%
-				0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00,  //+.++.+
-				0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00,  //%.%.+.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
-
-			    /*Unicode: U+006e (n) , Width: 4 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@+
-				0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00,  //+%.%
-				0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //+..+
-				0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00,  //%.+.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+006f (o) , Width: 4 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //....
-				0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00,  //.%@+
-				0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //++.%
-				0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //%..%
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+0070 (p) , Width: 4 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //....
-				0x00, 0x00, 0xff, 0xff, 0xe8, 0xff, 0x00, 0x00,  //.%@+
-				0x00, 0x00, 0xff, 0xff, 0x16, 0xff, 0x00, 0x00,  //+%.%
-				0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //%+.%
-				0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //%%@.
-				0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //%...
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+0071 (q) , Width: 4 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //....
-				0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00,  //.@@+
-				0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //++.%
-				0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //%.++
-				0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //+@@.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+0072 (r) , Width: 3 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...
-				0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.%@
-				0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //+%.
-				0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //+..
-				0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //%..
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...
-
-
-			    /*Unicode: U+0073 (s) , Width: 4 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@+
-				0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //.@..
-				0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //..@.
-				0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //+@@.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+0074 (t) , Width: 3 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...
-			    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.%.
-				0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //%@.
-				0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.+.
-				0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //+..
-				0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //+%.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...
-
-
-			    /*Unicode: U+0075 (u) , Width: 4 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00,  //.%.%
-				0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00,  //++.%
-				0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //+.++
-				0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //+@%.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+0076 (v) , Width: 4 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //+..%
-				0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.++.
-				0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.%%.
-				0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //.@..
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+0077 (w) , Width: 6 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-				0x00, 0x68, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,  //+.%++.
-				0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //++%+%.
-				0x00, 0x38, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //.%+%+.
-				0x00, 0x1e, 0xcc, 0xff, 0x00, 0xff, 0x00, 0x00,  //.@.@..
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
-
-			    /*Unicode: U+0078 (x) , Width: 4 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00,  //.+++
-				0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.%%.
-				0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.%+.
-				0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00,  //%.%.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+0079 (y) , Width: 4 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00,  //....
-				0x00, 0x00, 0x46, 0xff, 0x00, 0xff, 0x00, 0x00,  //++.%
-				0x00, 0x00, 0x1e, 0x00, 0xff, 0x00, 0x00, 0x00,  //.+%.
-				0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.%%.
-				0x00, 0x00, 0x00, 0xff, 0x0e, 0x00, 0x00, 0x00,  //.@..
-				0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00,  //@+..
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-
-
-			    /*Unicode: U+007a (z) , Width: 4 */
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //+@@%
-				0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //..%.
-				0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //+@..
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....
+		  0xff,  //@@@@@@@@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0xff,  //@@@@@@@@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x00,  //........
+
+		  /*Unicode: U+0042 (B) , Width: 8 */
+		  0xff,  //@@@@@@@@
+		  0x81,  //@......@
+		  0x82,  //@.....@.
+		  0xfe,  //@@@@@@@.
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0xfe,  //@@@@@@@.
+		  0x00,  //........
+
+		  /*Unicode: U+0043 (C) , Width: 8 */
+		  0xff,  //@@@@@@@@
+		  0x80,  //@.......
+		  0x80,  //@.......
+		  0x80,  //@.......
+		  0x80,  //@.......
+		  0x81,  //@......@
+		  0xff,  //@@@@@@@@
+		  0x00,  //........
+
+		  /*Unicode: U+0044 (D) , Width: 8 */
+		  0xff,  //@@@@@@@@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0xfe,  //@@@@@@@.
+		  0x00,  //........
+
+		  /*Unicode: U+0045 (E) , Width: 8 */
+		  0xff,  //@@@@@@@@
+		  0x80,  //@.......
+		  0x80,  //@.......
+		  0xf8,  //@@@@@...
+		  0x80,  //@.......
+		  0x80,  //@.......
+		  0x7f,  //.@@@@@@@
+		  0x00,  //........
+
+		  /*Unicode: U+0046 (F) , Width: 8 */
+		  0xff,  //@@@@@@@@
+		  0x80,  //@.......
+		  0x80,  //@.......
+		  0xf8,  //@@@@@...
+		  0x80,  //@.......
+		  0x80,  //@.......
+		  0x80,  //@.......
+		  0x00,  //........
+
+		  /*Unicode: U+0047 (G) , Width: 8 */
+		  0xff,  //@@@@@@@@
+		  0x80,  //@.......
+		  0x80,  //@.......
+		  0x9e,  //@..@@@@.
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x7e,  //.@@@@@@.
+		  0x00,  //........
+
+		  /*Unicode: U+0048 (H) , Width: 8 */
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0xff,  //@@@@@@@@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x00,  //........
+
+		  /*Unicode: U+0049 (I) , Width: 8 */
+		  0xff,  //@@@@@@@@
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0xff,  //@@@@@@@@
+		  0x00,  //........
+
+		  /*Unicode: U+004a (J) , Width: 8 */
+		  0xff,  //@@@@@@@@
+		  0x01,  //.......@
+		  0x01,  //.......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x7e,  //.@@@@@@.
+		  0x00,  //........
+
+		  /*Unicode: U+004b (K) , Width: 8 */
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x82,  //@.....@.
+		  0xfe,  //@@@@@@@.
+		  0x82,  //@.....@.
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x00,  //........
+
+		  /*Unicode: U+004c (L) , Width: 8 */
+		  0x80,  //@.......
+		  0x80,  //@.......
+		  0x80,  //@.......
+		  0x80,  //@.......
+		  0x80,  //@.......
+		  0x80,  //@.......
+		  0x7f,  //.@@@@@@@
+		  0x00,  //........
+
+		  /*Unicode: U+004d (M) , Width: 8 */
+		  0xe7,  //@@@..@@@
+		  0x99,  //@..@@..@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x00,  //........
+
+		  /*Unicode: U+004e (N) , Width: 8 */
+		  0xc1,  //@@.....@
+		  0xa1,  //@.@....@
+		  0x91,  //@..@...@
+		  0x89,  //@...@..@
+		  0x85,  //@....@.@
+		  0x83,  //@.....@@
+		  0x81,  //@......@
+		  0x00,  //........
+
+		  /*Unicode: U+004f (O) , Width: 8 */
+		  0xff,  //@@@@@@@@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x7e,  //.@@@@@@.
+		  0x00,  //........
+
+		  /*Unicode: U+0050 (P) , Width: 8 */
+		  0xff,  //@@@@@@@@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0xfe,  //@@@@@@@.
+		  0x80,  //@.......
+		  0x80,  //@.......
+		  0x80,  //@.......
+		  0x00,  //........
+
+		  /*Unicode: U+0051 (Q) , Width: 8 */
+		  0xff,  //@@@@@@@@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x86,  //@....@@.
+		  0x79,  //.@@@@..@
+		  0x00,  //........
+
+		  /*Unicode: U+0052 (R) , Width: 8 */
+		  0xff,  //@@@@@@@@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0xfe,  //@@@@@@@.
+		  0x82,  //@.....@.
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x00,  //........
+
+		  /*Unicode: U+0053 (S) , Width: 8 */
+		  0xff,  //@@@@@@@@
+		  0x80,  //@.......
+		  0x80,  //@.......
+		  0x7e,  //.@@@@@@.
+		  0x01,  //.......@
+		  0x01,  //.......@
+		  0xfe,  //@@@@@@@.
+		  0x00,  //........
+
+		  /*Unicode: U+0054 (T) , Width: 8 */
+		  0xff,  //@@@@@@@@
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x00,  //........
+
+		  /*Unicode: U+0055 (U) , Width: 8 */
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x7e,  //.@@@@@@.
+		  0x00,  //........
+
+		  /*Unicode: U+0056 (V) , Width: 8 */
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x66,  //.@@..@@.
+		  0x18,  //...@@...
+		  0x00,  //........
+
+		  /*Unicode: U+0057 (W) , Width: 8 */
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0xbd,  //@.@@@@.@
+		  0x66,  //.@@..@@.
+		  0x00,  //........
+
+		  /*Unicode: U+0058 (X) , Width: 8 */
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0xc3,  //@@....@@
+		  0x3e,  //..@@@@@.
+		  0x42,  //.@....@.
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x00,  //........
+
+		  /*Unicode: U+0059 (Y) , Width: 8 */
+		  0x81,  //@......@
+		  0x81,  //@......@
+		  0x42,  //.@....@.
+		  0x3c,  //..@@@@..
+		  0x08,  //....@...
+		  0x08,  //....@...
+		  0x08,  //....@...
+		  0x00,  //........
+
+		  /*Unicode: U+005a (Z) , Width: 8 */
+		  0xff,  //@@@@@@@@
+		  0x04,  //.....@..
+		  0x08,  //....@...
+		  0x10,  //...@....
+		  0x20,  //..@.....
+		  0x40,  //.@......
+		  0xff,  //@@@@@@@@
+		  0x00,  //........
 
+		  /*Unicode: U+0041 (A) , Width: 8 */
+		  0x7e,  //.@@@@@@.
+		  0xff,  //@@@@@@@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xff,  //@@@@@@@@
+		  0xff,  //@@@@@@@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+
+		  /*Unicode: U+0042 (B) , Width: 8 */
+		  0x7e,  //.@@@@@@.
+		  0xff,  //@@@@@@@@
+		  0xc3,  //@@....@@
+		  0xfe,  //@@@@@@@.
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xff,  //@@@@@@@@
+		  0xfe,  //@@@@@@@.
+
+		  /*Unicode: U+0043 (C) , Width: 8 */
+		  0x7e,  //.@@@@@@.
+		  0xff,  //@@@@@@@@
+		  0xc3,  //@@....@@
+		  0xc0,  //@@......
+		  0xc0,  //@@......
+		  0xc3,  //@@....@@
+		  0xff,  //@@@@@@@@
+		  0x7e,  //.@@@@@@.
+
+		  /*Unicode: U+0044 (D) , Width: 8 */
+		  0x7e,  //.@@@@@@.
+		  0xff,  //@@@@@@@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xff,  //@@@@@@@@
+		  0xfe,  //@@@@@@@.
+
+		  /*Unicode: U+0045 (E) , Width: 8 */
+		  0x7f,  //.@@@@@@@
+		  0xff,  //@@@@@@@@
+		  0xc0,  //@@......
+		  0xf8,  //@@@@@...
+		  0xc0,  //@@......
+		  0xc0,  //@@......
+		  0xfe,  //@@@@@@@.
+		  0x7f,  //.@@@@@@@
+
+		  /*Unicode: U+0046 (F) , Width: 8 */
+		  0xff,  //@@@@@@@@
+		  0xfe,  //@@@@@@@.
+		  0xc0,  //@@......
+		  0xf8,  //@@@@@...
+		  0xf8,  //@@@@@...
+		  0xc0,  //@@......
+		  0xc0,  //@@......
+		  0xc0,  //@@......
+
+		  /*Unicode: U+0047 (G) , Width: 8 */
+		  0x7f,  //.@@@@@@@
+		  0xff,  //@@@@@@@@
+		  0xe0,  //@@@.....
+		  0xcf,  //@@..@@@@
+		  0xcf,  //@@..@@@@
+		  0xc3,  //@@....@@
+		  0xff,  //@@@@@@@@
+		  0x7e,  //.@@@@@@.
+
+		  /*Unicode: U+0048 (H) , Width: 8 */
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xff,  //@@@@@@@@
+		  0xff,  //@@@@@@@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+
+		  /*Unicode: U+0049 (I) , Width: 8 */
+		  0x00,  //........
+		  0xff,  //@@@@@@@@
+		  0xff,  //@@@@@@@@
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+		  0xff,  //@@@@@@@@
+		  0xff,  //@@@@@@@@
+
+		  /*Unicode: U+004a (J) , Width: 8 */
+		  0x00,  //........
+		  0xff,  //@@@@@@@@
+		  0xff,  //@@@@@@@@
+		  0x03,  //......@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xff,  //@@@@@@@@
+		  0x7e,  //.@@@@@@.
+
+		  /*Unicode: U+004b (K) , Width: 8 */
+		  0x00,  //........
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xff,  //@@@@@@@@
+		  0xfe,  //@@@@@@@.
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+
+		  /*Unicode: U+004c (L) , Width: 8 */
+		  0x00,  //........
+		  0xc0,  //@@......
+		  0xc0,  //@@......
+		  0xc0,  //@@......
+		  0xc0,  //@@......
+		  0xc0,  //@@......
+		  0xfe,  //@@@@@@@.
+		  0x7f,  //.@@@@@@@
+
+		  /*Unicode: U+004d (M) , Width: 8 */
+		  0x00,  //........
+		  0xff,  //@@@@@@@@
+		  0xff,  //@@@@@@@@
+		  0xdb,  //@@.@@.@@
+		  0xdb,  //@@.@@.@@
+		  0xdb,  //@@.@@.@@
+		  0xdb,  //@@.@@.@@
+		  0xdb,  //@@.@@.@@
+
+		  /*Unicode: U+004e (N) , Width: 8 */
+		  0x00,  //........
+		  0xe3,  //@@@...@@
+		  0xe3,  //@@@...@@
+		  0xf3,  //@@@@..@@
+		  0xfb,  //@@@@@.@@
+		  0xdf,  //@@.@@@@@
+		  0xc7,  //@@...@@@
+		  0xc3,  //@@....@@
+
+		  /*Unicode: U+004f (O) , Width: 8 */
+		  0x00,  //........
+		  0x7e,  //.@@@@@@.
+		  0xff,  //@@@@@@@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xff,  //@@@@@@@@
+		  0x7e,  //.@@@@@@.
+
+		  /*Unicode: U+0050 (P) , Width: 8 */
+		  0x7e,  //.@@@@@@.
+		  0xff,  //@@@@@@@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xfe,  //@@@@@@@.
+		  0xfe,  //@@@@@@@.
+		  0xc0,  //@@......
+		  0xc0,  //@@......
+
+		  /*Unicode: U+0051 (Q) , Width: 8 */
+		  0x00,  //........
+		  0x7e,  //.@@@@@@.
+		  0xff,  //@@@@@@@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xc6,  //@@...@@.
+		  0xff,  //@@@@@@@@
+		  0xfb,  //@@@@@.@@
+
+		  /*Unicode: U+0052 (R) , Width: 8 */
+		  0xfe,  //@@@@@@@.
+		  0xff,  //@@@@@@@@
+		  0xc3,  //@@....@@
+		  0xff,  //@@@@@@@@
+		  0xfe,  //@@@@@@@.
+		  0xc7,  //@@...@@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+
+		  /*Unicode: U+0053 (S) , Width: 8 */
+		  0x7f,  //.@@@@@@@
+		  0xff,  //@@@@@@@@
+		  0xc0,  //@@......
+		  0xfe,  //@@@@@@@.
+		  0x7f,  //.@@@@@@@
+		  0x03,  //......@@
+		  0xff,  //@@@@@@@@
+		  0xfe,  //@@@@@@@.
+
+		  /*Unicode: U+0054 (T) , Width: 8 */
+		  0xff,  //@@@@@@@@
+		  0xff,  //@@@@@@@@
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+
+		  /*Unicode: U+0055 (U) , Width: 8 */
+		  0x00,  //........
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xff,  //@@@@@@@@
+		  0x7e,  //.@@@@@@.
+
+		  /*Unicode: U+0056 (V) , Width: 8 */
+		  0x00,  //........
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xe7,  //@@@..@@@
+		  0x7e,  //.@@@@@@.
+		  0x3c,  //..@@@@..
+
+		  /*Unicode: U+0057 (W) , Width: 8 */
+		  0x00,  //........
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xdb,  //@@.@@.@@
+		  0xdb,  //@@.@@.@@
+		  0xdb,  //@@.@@.@@
+		  0xff,  //@@@@@@@@
+		  0x6e,  //.@@.@@@.
+
+		  /*Unicode: U+0058 (X) , Width: 8 */
+		  0x00,  //........
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xff,  //@@@@@@@@
+		  0x7e,  //.@@@@@@.
+		  0xe7,  //@@@..@@@
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+
+		  /*Unicode: U+0059 (Y) , Width: 8 */
+		  0x00,  //........
+		  0xc3,  //@@....@@
+		  0xc3,  //@@....@@
+		  0xff,  //@@@@@@@@
+		  0x7e,  //.@@@@@@.
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+
+		  /*Unicode: U+005a (Z) , Width: 8 */
+		  0x00,  //........
+		  0xff,  //@@@@@@@@
+		  0xff,  //@@@@@@@@
+		  0x0e,  //....@@@.
+		  0x18,  //...@@...
+		  0x70,  //.@@@....
+		  0xff,  //@@@@@@@@
+		  0xff,  //@@@@@@@@
+
+		  /*Unicode: U+0041 (A) , Width: 5 */
+		  0x00,  //........
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+		  0x28,  //..@.@...
+		  0x78,  //.@@@@...
+		  0x48,  //.@..@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0042 (B) , Width: 5 */
+		  0x00,  //........
+		  0x3c,  //..@@@@..
+		  0x2c,  //..@.@@..
+		  0x38,  //..@@@...
+		  0x6c,  //.@@.@@..
+		  0x78,  //.@@@@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0043 (C) , Width: 6 */
+		  0x00,  //........
+		  0x1c,  //...@@@..
+		  0x24,  //..@..@..
+		  0x60,  //.@@.....
+		  0x6c,  //.@@.@@..
+		  0x38,  //..@@@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0044 (D) , Width: 5 */
+		  0x00,  //........
+		  0x3c,  //..@@@@..
+		  0x24,  //..@..@..
+		  0x24,  //..@..@..
+		  0x4c,  //.@..@@..
+		  0x78,  //.@@@@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0045 (E) , Width: 5 */
+		  0x00,  //........
+		  0x3c,  //..@@@@..
+		  0x20,  //..@.....
+		  0x3c,  //..@@@@..
+		  0x60,  //.@@.....
+		  0x78,  //.@@@@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0046 (F) , Width: 5 */
+		  0x00,  //........
+		  0x3c,  //..@@@@..
+		  0x20,  //..@.....
+		  0x38,  //..@@@...
+		  0x60,  //.@@.....
+		  0x40,  //.@......
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0047 (G) , Width: 6 */
+		  0x00,  //........
+		  0x1c,  //...@@@..
+		  0x20,  //..@.....
+		  0x2c,  //..@.@@..
+		  0x24,  //..@..@..
+		  0x38,  //..@@@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0048 (H) , Width: 6 */
+		  0x00,  //........
+		  0x24,  //..@..@..
+		  0x24,  //..@..@..
+		  0x3c,  //..@@@@..
+		  0x64,  //.@@..@..
+		  0x4c,  //.@..@@..
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0049 (I) , Width: 3 */
+		  0x00,  //........
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x30,  //..@@....
+		  0x20,  //..@.....
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+004a (J) , Width: 4 */
+		  0x00,  //........
+		  0x04,  //.....@..
+		  0x04,  //.....@..
+		  0x08,  //....@...
+		  0x28,  //..@.@...
+		  0x38,  //..@@@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+004b (K) , Width: 6 */
+		  0x00,  //........
+		  0x2c,  //..@.@@..
+		  0x38,  //..@@@...
+		  0x30,  //..@@....
+		  0x68,  //.@@.@...
+		  0x4c,  //.@..@@..
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+004c (L) , Width: 4 */
+		  0x00,  //........
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x20,  //..@.....
+		  0x38,  //..@@@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+004d (M) , Width: 7 */
+		  0x00,  //........
+		  0x24,  //..@..@..
+		  0x3c,  //..@@@@..
+		  0x54,  //.@.@.@..
+		  0x54,  //.@.@.@..
+		  0x54,  //.@.@.@..
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+004e (N) , Width: 6 */
+		  0x00,  //........
+		  0x24,  //..@..@..
+		  0x34,  //..@@.@..
+		  0x74,  //.@@@.@..
+		  0x5c,  //.@.@@@..
+		  0x48,  //.@..@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+004f (O) , Width: 6 */
+		  0x00,  //........
+		  0x3c,  //..@@@@..
+		  0x26,  //..@..@@.
+		  0x66,  //.@@..@@.
+		  0x24,  //..@..@..
+		  0x3c,  //..@@@@..
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0050 (P) , Width: 5 */
+		  0x00,  //........
+		  0x1e,  //...@@@@.
+		  0x12,  //...@..@.
+		  0x1e,  //...@@@@.
+		  0x30,  //..@@....
+		  0x20,  //..@.....
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0051 (Q) , Width: 6 */
+		  0x00,  //........
+		  0x3c,  //..@@@@..
+		  0x26,  //..@..@@.
+		  0x66,  //.@@..@@.
+		  0x24,  //..@..@..
+		  0x3c,  //..@@@@..
+		  0x04,  //.....@..
+		  0x00,  //........
+
+		  /*Unicode: U+0052 (R) , Width: 6 */
+		  0x00,  //........
+		  0x3c,  //..@@@@..
+		  0x24,  //..@..@..
+		  0x3c,  //..@@@@..
+		  0x68,  //.@@.@...
+		  0x44,  //.@...@..
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0053 (S) , Width: 5 */
+		  0x00,  //........
+		  0x38,  //..@@@...
+		  0x20,  //..@.....
+		  0x08,  //....@...
+		  0x6c,  //.@@.@@..
+		  0x38,  //..@@@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0054 (T) , Width: 5 */
+		  0x00,  //........
+		  0x3c,  //..@@@@..
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x20,  //..@.....
+		  0x20,  //..@.....
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0055 (U) , Width: 6 */
+		  0x00,  //........
+		  0x24,  //..@..@..
+		  0x24,  //..@..@..
+		  0x24,  //..@..@..
+		  0x6c,  //.@@.@@..
+		  0x38,  //..@@@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0056 (V) , Width: 6 */
+		  0x00,  //........
+		  0x24,  //..@..@..
+		  0x24,  //..@..@..
+		  0x28,  //..@.@...
+		  0x38,  //..@@@...
+		  0x30,  //..@@....
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0057 (W) , Width: 8 */
+		  0x00,  //........
+		  0x5a,  //.@.@@.@.
+		  0x5a,  //.@.@@.@.
+		  0x6c,  //.@@.@@..
+		  0x6c,  //.@@.@@..
+		  0x48,  //.@..@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0058 (X) , Width: 6 */
+		  0x00,  //........
+		  0x24,  //..@..@..
+		  0x38,  //..@@@...
+		  0x10,  //...@....
+		  0x38,  //..@@@...
+		  0x48,  //.@..@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0059 (Y) , Width: 6 */
+		  0x00,  //........
+		  0x24,  //..@..@..
+		  0x2c,  //..@.@@..
+		  0x18,  //...@@...
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+005a (Z) , Width: 5 */
+		  0x00,  //........
+		  0x3c,  //..@@@@..
+		  0x08,  //....@...
+		  0x10,  //...@....
+		  0x20,  //..@.....
+		  0x78,  //.@@@@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0061 (a) , Width: 4 */
+		  0x00,  //........
+		  0x1c,  //...@@@..
+		  0x04,  //.....@..
+		  0x1e,  //...@@@@.
+		  0x26,  //..@..@@.
+		  0x1c,  //...@@@..
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0062 (b) , Width: 4 */
+		  0x00,  //........
+		  0x10,  //...@....
+		  0x1c,  //...@@@..
+		  0x14,  //...@.@..
+		  0x24,  //..@..@..
+		  0x38,  //..@@@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0063 (c) , Width: 4 */
+		  0x00,  //........
+		  0x00,  //........
+		  0x1c,  //...@@@..
+		  0x30,  //..@@....
+		  0x20,  //..@.....
+		  0x38,  //..@@@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0064 (d) , Width: 5 */
+		  0x00,  //........
+		  0x04,  //.....@..
+		  0x1c,  //...@@@..
+		  0x34,  //..@@.@..
+		  0x2c,  //..@.@@..
+		  0x38,  //..@@@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0065 (e) , Width: 4 */
+		  0x00,  //........
+		  0x1c,  //...@@@..
+		  0x34,  //..@@.@..
+		  0x38,  //..@@@...
+		  0x20,  //..@.....
+		  0x18,  //...@@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0066 (f) , Width: 3 */
+		  0x00,  //........
+		  0x18,  //...@@...
+		  0x10,  //...@....
+		  0x38,  //..@@@...
+		  0x10,  //...@....
+		  0x20,  //..@.....
+		  0x20,  //..@.....
+		  0x00,  //........
+
+		  /*Unicode: U+0067 (g) , Width: 4 */
+		  0x00,  //........
+		  0x1c,  //...@@@..
+		  0x14,  //...@.@..
+		  0x18,  //...@@...
+		  0x08,  //....@...
+		  0x28,  //..@.@...
+		  0x10,  //...@....
+		  0x00,  //........
+
+		  /*Unicode: U+0068 (h) , Width: 4 */
+		  0x00,  //........
+		  0x10,  //...@....
+		  0x1c,  //...@@@..
+		  0x14,  //...@.@..
+		  0x24,  //..@..@..
+		  0x28,  //..@.@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0069 (i) , Width: 2 */
+		  0x08,  //....@...
+		  0x00,  //........
+		  0x08,  //....@...
+		  0x18,  //...@@...
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x00,  //........
+
+		  /*Unicode: U+006a (j) , Width: 2 */
+		  0x08,  //....@...
+		  0x00,  //........
+		  0x08,  //....@...
+		  0x48,  //.@..@...
+		  0x50,  //.@.@....
+		  0x30,  //..@@....
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+006b (k) , Width: 4 */
+		  0x00,  //........
+		  0x10,  //...@....
+		  0x14,  //...@.@..
+		  0x18,  //...@@...
+		  0x38,  //..@@@...
+		  0x28,  //..@.@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+006c (l) , Width: 2 */
+		  0x00,  //........
+		  0x08,  //....@...
+		  0x08,  //....@...
+		  0x18,  //...@@...
+		  0x10,  //...@....
+		  0x10,  //...@....
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+006d (m) , Width: 6 */
+		  0x00,  //........
+		  0x00,  //........
+		  0x3e,  //..@@@@@.
+		  0x6a,  //.@@.@.@.
+		  0x5a,  //.@.@@.@.
+		  0x54,  //.@.@.@..
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+006e (n) , Width: 4 */
+		  0x00,  //........
+		  0x00,  //........
+		  0x1c,  //...@@@..
+		  0x34,  //..@@.@..
+		  0x24,  //..@..@..
+		  0x28,  //..@.@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+006f (o) , Width: 4 */
+		  0x00,  //........
+		  0x1c,  //...@@@..
+		  0x34,  //..@@.@..
+		  0x24,  //..@..@..
+		  0x38,  //..@@@...
+		  0x00,  //........
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0070 (p) , Width: 4 */
+		  0x00,  //........
+		  0x1c,  //...@@@..
+		  0x34,  //..@@.@..
+		  0x34,  //..@@.@..
+		  0x38,  //..@@@...
+		  0x20,  //..@.....
+		  0x20,  //..@.....
+		  0x00,  //........
+
+		  /*Unicode: U+0071 (q) , Width: 4 */
+		  0x00,  //........
+		  0x1c,  //...@@@..
+		  0x34,  //..@@.@..
+		  0x2c,  //..@.@@..
+		  0x38,  //..@@@...
+		  0x08,  //....@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0072 (r) , Width: 3 */
+		  0x00,  //........
+		  0x00,  //........
+		  0x18,  //...@@...
+		  0x30,  //..@@....
+		  0x20,  //..@.....
+		  0x20,  //..@.....
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0073 (s) , Width: 4 */
+		  0x00,  //........
+		  0x00,  //........
+		  0x1c,  //...@@@..
+		  0x10,  //...@....
+		  0x08,  //....@...
+		  0x38,  //..@@@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0074 (t) , Width: 3 */
+		  0x00,  //........
+		  0x08,  //....@...
+		  0x18,  //...@@...
+		  0x08,  //....@...
+		  0x10,  //...@....
+		  0x18,  //...@@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0075 (u) , Width: 4 */
+		  0x00,  //........
+		  0x00,  //........
+		  0x14,  //...@.@..
+		  0x34,  //..@@.@..
+		  0x2c,  //..@.@@..
+		  0x38,  //..@@@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0076 (v) , Width: 4 */
+		  0x00,  //........
+		  0x00,  //........
+		  0x24,  //..@..@..
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+		  0x10,  //...@....
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0077 (w) , Width: 6 */
+		  0x00,  //........
+		  0x00,  //........
+		  0x2a,  //..@.@.@.
+		  0x3c,  //..@@@@..
+		  0x1c,  //...@@@..
+		  0x14,  //...@.@..
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0078 (x) , Width: 4 */
+		  0x00,  //........
+		  0x00,  //........
+		  0x14,  //...@.@..
+		  0x18,  //...@@...
+		  0x18,  //...@@...
+		  0x28,  //..@.@...
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+0079 (y) , Width: 4 */
+		  0x00,  //........
+		  0x14,  //...@.@..
+		  0x14,  //...@.@..
+		  0x08,  //....@...
+		  0x18,  //...@@...
+		  0x10,  //...@....
+		  0x00,  //........
+		  0x00,  //........
+
+		  /*Unicode: U+007a (z) , Width: 4 */
+		  0x00,  //........
+		  0x3c,  //..@@@@..
+		  0x18,  //...@@...
+		  0x30,  //..@@....
+		  0x3c,  //..@@@@..
+		  0x00,  //........
+		  0x00,  //........
+		  0x00,  //........
 };
 
-uint16_t bmLookup[BM_AMOUNT][4];
+//--------------------------------------------------------------
+// Bitmap directory, indexed by bitmap number
+// The glyphs are stored per font set of ALPHABET_SIZE letters:
+//   0..25    arial normal      ('a'..'z')
+//   26..51   arial bold        ('A'..'Z')
+//   52..77   arial cursive     (0..25)
+//   78..103  consolas normal   (26..51)
+//   104..129 consolas bold     (500..525)
+//   130..155 consolas cursive  (526..551)
+//--------------------------------------------------------------
+#define BM_TEXT(nr) { TEXT_SIZE, TEXT_SIZE, (nr) * TEXT_SIZE * BM_ROW_BYTES(TEXT_SIZE) }
+#define BM_TEXT2(nr) BM_TEXT(nr), BM_TEXT((nr) + 1)
+#define BM_TEXT8(nr) BM_TEXT2(nr), BM_TEXT2((nr) + 2), BM_TEXT2((nr) + 4), BM_TEXT2((nr) + 6)
+#define BM_FONT_SET(set) \
+		BM_TEXT8((set) * ALPHABET_SIZE), BM_TEXT8((set) * ALPHABET_SIZE + 8), \
+		BM_TEXT8((set) * ALPHABET_SIZE + 16), BM_TEXT2((set) * ALPHABET_SIZE + 24)
+
+_Static_assert(ALPHABET_SIZE == 26, "BM_FONT_SET expands 26 glyphs");
+_Static_assert(BM_AMOUNT == BM_FONTS * BM_STYLES * ALPHABET_SIZE, "one font set per font and style");
+_Static_assert(sizeof(bitmap_1bpp) == BM_AMOUNT * TEXT_SIZE * BM_ROW_BYTES(TEXT_SIZE), "a glyph for every bitmap");
+
+const BM_INFO_t bmInfo[] =
+{
+		BM_FONT_SET(0), BM_FONT_SET(1), BM_FONT_SET(2),
+		BM_FONT_SET(3), BM_FONT_SET(4), BM_FONT_SET(5)
+};
+
+_Static_assert(sizeof(bmInfo) / sizeof(bmInfo[0]) == BM_AMOUNT, "a directory entry for every bitmap");
+
+//--------------------------------------------------------------
+// Bitmap IDs to bitmap numbers, ranges do not overlap
+//--------------------------------------------------------------
+static const BM_ID_RANGE_t bmIdRange[BM_ID_RANGES] =
+{
+		{ 'a', ALPHABET_SIZE,     0 },
+		{ 'A', ALPHABET_SIZE,     ALPHABET_SIZE },
+		{ 0,   ALPHABET_SIZE * 2, ALPHABET_SIZE * 2 },
+		{ 500, ALPHABET_SIZE * 2, ALPHABET_SIZE * 4 }
+};
 
 //--------------------------------------------------------------
-// @brief Initializes bitmap
-// @details This function generates and initializes all the necessary memory and registers for the bitmaps to function
+// Character ROM of the text modes, indexed by ASCII code
+// One byte per glyph row, MSB = most left pixel; most glyphs leave the last
+// column and row empty as space between the letters. Control codes are blank.
 //--------------------------------------------------------------
-void Bitmap_init()
+const uint8_t font_8x8[FONT_CHARS][FONT_ROWS] =
 {
-	//----------------------------------------------------------
-	// Generate lookup table
-	//----------------------------------------------------------
-	uint16_t i;
-
-	for(i = 0; i < BM_AMOUNT; i++)
-	{	if(i < ALPHABET_SIZE)
-		{
-			bmLookup[i][ID] = ('a' + i);
-			bmLookup[i][X_LEN] = 8;
-			bmLookup[i][Y_LEN] = 8;
-			bmLookup[i][OFFSET] = (TEXT_SIZE * TEXT_SIZE * i);
-		}
-		else if((i >= ALPHABET_SIZE) && (i < (ALPHABET_SIZE*2)))
-		{
-			bmLookup[i][ID] = ('A' + (i - 26));
-			bmLookup[i][X_LEN] = 8;
-			bmLookup[i][Y_LEN] = 8;
-			bmLookup[i][OFFSET] = (TEXT_SIZE * TEXT_SIZE * i);
-		}
-		else if((i >= (ALPHABET_SIZE*2)) && (i < (ALPHABET_SIZE*4)))
-		{
-			bmLookup[i][ID] = (i-(ALPHABET_SIZE*2));
-			bmLookup[i][X_LEN] = 8;
-			bmLookup[i][Y_LEN] = 8;
-			bmLookup[i][OFFSET] = (TEXT_SIZE * TEXT_SIZE * i);
-		}
-		else if((i >= (ALPHABET_SIZE*4)) && (i < (ALPHABET_SIZE*6)))
-		{
-			bmLookup[i][ID] = ((i-(ALPHABET_SIZE*4))+500);
-			bmLookup[i][X_LEN] = 8;
-			bmLookup[i][Y_LEN] = 8;
-			bmLookup[i][OFFSET] = (TEXT_SIZE * TEXT_SIZE * i);
-		}
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x00
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x01
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x02
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x03
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x04
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x05
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x06
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x07
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x08
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x09
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x0A
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x0B
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x0C
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x0D
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x0E
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x0F
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x10
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x11
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x12
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x13
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x14
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x15
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x16
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x17
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x18
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x19
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x1A
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x1B
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x1C
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x1D
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x1E
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x1F
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// ' '
+		{ 0x18, 0x3c, 0x3c, 0x18, 0x18, 0x00, 0x18, 0x00 },	// '!'
+		{ 0x66, 0x66, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00 },	// '"'
+		{ 0x6c, 0x6c, 0xfe, 0x6c, 0xfe, 0x6c, 0x6c, 0x00 },	// '#'
+		{ 0x18, 0x3e, 0x60, 0x3c, 0x06, 0x7c, 0x18, 0x00 },	// '$'
+		{ 0x00, 0xc6, 0xcc, 0x18, 0x30, 0x66, 0xc6, 0x00 },	// '%'
+		{ 0x38, 0x6c, 0x38, 0x76, 0xdc, 0xcc, 0x76, 0x00 },	// '&'
+		{ 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00 },	// '\''
+		{ 0x0c, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0c, 0x00 },	// '('
+		{ 0x30, 0x18, 0x0c, 0x0c, 0x0c, 0x18, 0x30, 0x00 },	// ')'
+		{ 0x00, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x00, 0x00 },	// '*'
+		{ 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00 },	// '+'
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30 },	// ','
+		{ 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// '-'
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00 },	// '.'
+		{ 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x00 },	// '/'
+		{ 0x7c, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0x7c, 0x00 },	// '0'
+		{ 0x18, 0x38, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00 },	// '1'
+		{ 0x7c, 0xc6, 0x06, 0x1c, 0x70, 0xc0, 0xfe, 0x00 },	// '2'
+		{ 0x7c, 0xc6, 0x06, 0x3c, 0x06, 0xc6, 0x7c, 0x00 },	// '3'
+		{ 0x1c, 0x3c, 0x6c, 0xcc, 0xfe, 0x0c, 0x0c, 0x00 },	// '4'
+		{ 0xfe, 0xc0, 0xfc, 0x06, 0x06, 0xc6, 0x7c, 0x00 },	// '5'
+		{ 0x38, 0x60, 0xc0, 0xfc, 0xc6, 0xc6, 0x7c, 0x00 },	// '6'
+		{ 0xfe, 0xc6, 0x0c, 0x18, 0x30, 0x30, 0x30, 0x00 },	// '7'
+		{ 0x7c, 0xc6, 0xc6, 0x7c, 0xc6, 0xc6, 0x7c, 0x00 },	// '8'
+		{ 0x7c, 0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0x78, 0x00 },	// '9'
+		{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00 },	// ':'
+		{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x30 },	// ';'
+		{ 0x06, 0x0c, 0x18, 0x30, 0x18, 0x0c, 0x06, 0x00 },	// '<'
+		{ 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00 },	// '='
+		{ 0x60, 0x30, 0x18, 0x0c, 0x18, 0x30, 0x60, 0x00 },	// '>'
+		{ 0x7c, 0xc6, 0x06, 0x0c, 0x18, 0x00, 0x18, 0x00 },	// '?'
+		{ 0x7c, 0xc6, 0xde, 0xde, 0xde, 0xc0, 0x7c, 0x00 },	// '@'
+		{ 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0x00 },	// 'A'
+		{ 0xfc, 0xc6, 0xc6, 0xfc, 0xc6, 0xc6, 0xfc, 0x00 },	// 'B'
+		{ 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00 },	// 'C'
+		{ 0xf8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xf8, 0x00 },	// 'D'
+		{ 0xfe, 0xc0, 0xc0, 0xf8, 0xc0, 0xc0, 0xfe, 0x00 },	// 'E'
+		{ 0xfe, 0xc0, 0xc0, 0xf8, 0xc0, 0xc0, 0xc0, 0x00 },	// 'F'
+		{ 0x7c, 0xc6, 0xc0, 0xde, 0xc6, 0xc6, 0x7e, 0x00 },	// 'G'
+		{ 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00 },	// 'H'
+		{ 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00 },	// 'I'
+		{ 0x1e, 0x06, 0x06, 0x06, 0xc6, 0xc6, 0x7c, 0x00 },	// 'J'
+		{ 0xc6, 0xcc, 0xd8, 0xf0, 0xd8, 0xcc, 0xc6, 0x00 },	// 'K'
+		{ 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0x00 },	// 'L'
+		{ 0xc6, 0xee, 0xfe, 0xd6, 0xc6, 0xc6, 0xc6, 0x00 },	// 'M'
+		{ 0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0xc6, 0x00 },	// 'N'
+		{ 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00 },	// 'O'
+		{ 0xfc, 0xc6, 0xc6, 0xfc, 0xc0, 0xc0, 0xc0, 0x00 },	// 'P'
+		{ 0x7c, 0xc6, 0xc6, 0xc6, 0xd6, 0xcc, 0x76, 0x00 },	// 'Q'
+		{ 0xfc, 0xc6, 0xc6, 0xfc, 0xd8, 0xcc, 0xc6, 0x00 },	// 'R'
+		{ 0x7c, 0xc6, 0xc0, 0x7c, 0x06, 0xc6, 0x7c, 0x00 },	// 'S'
+		{ 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00 },	// 'T'
+		{ 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00 },	// 'U'
+		{ 0xc6, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x10, 0x00 },	// 'V'
+		{ 0xc6, 0xc6, 0xc6, 0xd6, 0xfe, 0xee, 0xc6, 0x00 },	// 'W'
+		{ 0xc6, 0x6c, 0x38, 0x38, 0x38, 0x6c, 0xc6, 0x00 },	// 'X'
+		{ 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x00 },	// 'Y'
+		{ 0xfe, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xfe, 0x00 },	// 'Z'
+		{ 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x00 },	// '['
+		{ 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x00 },	// '\\'
+		{ 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x00 },	// ']'
+		{ 0x10, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00 },	// '^'
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff },	// '_'
+		{ 0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// '`'
+		{ 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00 },	// 'a'
+		{ 0xc0, 0xc0, 0xfc, 0xc6, 0xc6, 0xc6, 0xfc, 0x00 },	// 'b'
+		{ 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c, 0x00 },	// 'c'
+		{ 0x06, 0x06, 0x7e, 0xc6, 0xc6, 0xc6, 0x7e, 0x00 },	// 'd'
+		{ 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00 },	// 'e'
+		{ 0x3c, 0x66, 0x60, 0xf8, 0x60, 0x60, 0x60, 0x00 },	// 'f'
+		{ 0x00, 0x00, 0x7e, 0xc6, 0xc6, 0x7e, 0x06, 0x7c },	// 'g'
+		{ 0xc0, 0xc0, 0xfc, 0xc6, 0xc6, 0xc6, 0xc6, 0x00 },	// 'h'
+		{ 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00 },	// 'i'
+		{ 0x06, 0x00, 0x0e, 0x06, 0x06, 0xc6, 0xc6, 0x7c },	// 'j'
+		{ 0xc0, 0xc0, 0xcc, 0xd8, 0xf0, 0xd8, 0xcc, 0x00 },	// 'k'
+		{ 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00 },	// 'l'
+		{ 0x00, 0x00, 0xd8, 0xfe, 0xd6, 0xd6, 0xc6, 0x00 },	// 'm'
+		{ 0x00, 0x00, 0xfc, 0xc6, 0xc6, 0xc6, 0xc6, 0x00 },	// 'n'
+		{ 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00 },	// 'o'
+		{ 0x00, 0x00, 0xfc, 0xc6, 0xc6, 0xfc, 0xc0, 0xc0 },	// 'p'
+		{ 0x00, 0x00, 0x7e, 0xc6, 0xc6, 0x7e, 0x06, 0x06 },	// 'q'
+		{ 0x00, 0x00, 0xdc, 0xec, 0xc0, 0xc0, 0xc0, 0x00 },	// 'r'
+		{ 0x00, 0x00, 0x7e, 0xc0, 0x7c, 0x06, 0xfc, 0x00 },	// 's'
+		{ 0x30, 0x30, 0xfc, 0x30, 0x30, 0x36, 0x1c, 0x00 },	// 't'
+		{ 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x00 },	// 'u'
+		{ 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00 },	// 'v'
+		{ 0x00, 0x00, 0xc6, 0xd6, 0xd6, 0xfe, 0x6c, 0x00 },	// 'w'
+		{ 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x00 },	// 'x'
+		{ 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x7c },	// 'y'
+		{ 0x00, 0x00, 0xfe, 0x0c, 0x38, 0x60, 0xfe, 0x00 },	// 'z'
+		{ 0x0e, 0x18, 0x18, 0x70, 0x18, 0x18, 0x0e, 0x00 },	// '{'
+		{ 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00 },	// '|'
+		{ 0x70, 0x18, 0x18, 0x0e, 0x18, 0x18, 0x70, 0x00 },	// '}'
+		{ 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// '~'
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// 0x7F
+};
+
+//--------------------------------------------------------------
+// First bitmap number of every font set, [font - 1][style - 1]
+//--------------------------------------------------------------
+static const uint8_t bmFontSet[BM_FONTS][BM_STYLES] =
+{
+		{ ALPHABET_SIZE * 0, ALPHABET_SIZE * 1, ALPHABET_SIZE * 2 },	// ARIAL_FONT
+		{ ALPHABET_SIZE * 3, ALPHABET_SIZE * 4, ALPHABET_SIZE * 5 }		// CONSOLAS_FONT
+};
+
+//--------------------------------------------------------------
+// @brief Finds a bitmap by its ID
+// @details Checks the few ID ranges, the directory itself is indexed directly.
+//
+// @param[in] id: The number ID of the bitmap
+//
+// @return pointer to the directory entry, NULL if the ID does not exist
+//--------------------------------------------------------------
+const BM_INFO_t *Bitmap_find(uint16_t id)
+{
+	uint8_t i;
+	uint16_t rel;
+
+	for(i = 0; i < BM_ID_RANGES; i++)
+	{
+		rel = id - bmIdRange[i].first_id;	//wraps around for IDs below the range
+		if(rel < bmIdRange[i].count)
+			return &bmInfo[bmIdRange[i].first_nr + rel];
 	}
+
+	return NULL;
 }
 
+//--------------------------------------------------------------
+// @brief Finds the glyph of a letter
+// @details The font and style select a font set, the letter the glyph in that set.
+//			Only the letters 'a' to 'z' have a glyph.
+//
+// @param[in] font: ARIAL_FONT or CONSOLAS_FONT
+// @param[in] style: NORMAL_STYLE, BOLD_STYLE or CURSIVE_STYLE
+// @param[in] letter: The letter to look up
+//
+// @return pointer to the directory entry, NULL if there is no glyph
+//--------------------------------------------------------------
+const BM_INFO_t *Bitmap_glyph(uint8_t font, uint8_t style, char letter)
+{
+	uint8_t rel = letter - 'a';
+
+	if((font - 1u >= BM_FONTS) || (style - 1u >= BM_STYLES) || (rel >= ALPHABET_SIZE))
+		return NULL;
+
+	return &bmInfo[bmFontSet[font - 1][style - 1] + rel];
+}
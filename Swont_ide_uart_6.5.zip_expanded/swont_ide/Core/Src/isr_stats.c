@@ -0,0 +1,185 @@
+/*
+ * isr_stats.c
+ *
+ *  Created on: 17 okt. 2026
+ */
+#include "isr_stats.h"
+#include "usart.h"
+#include <stdio.h>
+#include <string.h>
+
+#if ISR_STATS
+
+typedef struct
+{
+	uint32_t count;					//recorded calls, written last
+	uint32_t min;					//cycles
+	uint32_t max;
+	uint64_t sum;
+	uint32_t hist[ISR_STATS_BINS];
+	uint8_t clear;					//set by the main loop, the next record starts over
+}ISR_STAT_S;
+
+// Only written by the handler of the stat, the main loop reads a copy, see statCopy
+static volatile ISR_STAT_S isr_stats[ISR_STAT_COUNT];
+
+static const char *const isr_names[ISR_STAT_COUNT] = {"latency", "tim2", "tim3", "usart2"};
+
+static void statCopy(uint8_t stat, ISR_STAT_S *s);
+
+//--------------------------------------------------------------
+// @brief Function starts the DWT cycle counter
+// @details Called once before the interrupts are started.
+//--------------------------------------------------------------
+void ISR_STATS_Init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+//--------------------------------------------------------------
+// @brief Function adds one measurement to a stat (called from the interrupt handlers)
+// @details Every stat belongs to one handler, so a stat is never written by two
+//			handlers at once. count is written last, see statCopy.
+//
+// @param[in] stat: ISR_STAT_...
+// @param[in] cycles: The measured core cycles
+//--------------------------------------------------------------
+void ISR_STATS_Record(uint8_t stat, uint32_t cycles)
+{
+	volatile ISR_STAT_S *s = &isr_stats[stat];
+	uint8_t bin = 0;
+	uint8_t i;
+
+	if(s->clear)
+	{
+		s->count = 0;
+		s->max = 0;
+		s->sum = 0;
+		for(i = 0; i < ISR_STATS_BINS; i++)
+			s->hist[i] = 0;
+		s->clear = 0;
+	}
+
+	// 64 << (bin - 1) <= cycles < 64 << bin
+	if(cycles >= ISR_STATS_FIRST_BIN)
+		bin = __CLZ(ISR_STATS_FIRST_BIN) + 1 - __CLZ(cycles);
+	if(bin >= ISR_STATS_BINS)
+		bin = ISR_STATS_BINS - 1;
+
+	if((s->count == 0) || (cycles < s->min))
+		s->min = cycles;
+	if(cycles > s->max)
+		s->max = cycles;
+	s->sum += cycles;
+	s->hist[bin]++;
+	s->count++;
+}
+
+//--------------------------------------------------------------
+// @brief Function records the entry latency of a timer interrupt
+// @details The timer counts up from the compare event until the handler reads it,
+//			a counter that wrapped at arr counts on from 0.
+//
+// @param[in] stat: ISR_STAT_...
+// @param[in] cnt: The counter, read first in the handler
+// @param[in] arr: The auto reload value of the timer
+// @param[in] ccr: The compare value that raised the interrupt
+//--------------------------------------------------------------
+void ISR_STATS_Latency(uint8_t stat, uint32_t cnt, uint32_t arr, uint32_t ccr)
+{
+	uint32_t ticks = (cnt >= ccr) ? cnt - ccr : cnt + arr + 1 - ccr;
+
+	ISR_STATS_Record(stat, ticks * ISR_STATS_TIM_CYCLES);
+}
+
+//--------------------------------------------------------------
+// @brief Function prints the calls and cycles of every handler, then starts over
+// @details One line per stat, so "stats" twice gives the timing between the two.
+//			The durations are counted from the first to the last instruction of the
+//			handler, the 12 cycles of stacking are not in it. The latency is only
+//			measured for TIM2 (the scanout), the line says so.
+//--------------------------------------------------------------
+void ISR_STATS_Print(void)
+{
+	ISR_STAT_S s;
+	char str[80];
+	const char *note;
+	uint8_t stat;
+
+	for(stat = 0; stat < ISR_STAT_COUNT; stat++)
+	{
+		statCopy(stat, &s);
+		note = (stat == ISR_STAT_LATENCY) ? " (tim2 only)" : "";
+		if(s.count == 0)
+			snprintf(str, sizeof(str), "%s%s: n 0\n\r", isr_names[stat], note);
+		else
+			snprintf(str, sizeof(str), "%s%s: n %lu min %lu mean %lu max %lu\n\r", isr_names[stat], note,
+					 (unsigned long)s.count, (unsigned long)s.min,
+					 (unsigned long)(s.sum / s.count), (unsigned long)s.max);
+		UART_Print(str);
+		isr_stats[stat].clear = 1;
+	}
+}
+
+//--------------------------------------------------------------
+// @brief Function prints the histogram of one stat, since the last ISR_STATS_Print
+// @details One line per bin that is not empty: the upper bound in cycles and the calls.
+//
+// @param[in] name: latency, tim2, tim3 or usart2
+//--------------------------------------------------------------
+void ISR_STATS_Histogram(const char *name)
+{
+	ISR_STAT_S s;
+	char str[40];
+	uint8_t stat;
+	uint8_t bin;
+
+	for(stat = 0; stat < ISR_STAT_COUNT; stat++)
+	{
+		if(strcmp(name, isr_names[stat]) == 0)
+			break;
+	}
+	if(stat == ISR_STAT_COUNT)
+	{
+		UART_Print("Error: unknown stat, use latency, tim2, tim3 or usart2\n\r");
+		return;
+	}
+
+	statCopy(stat, &s);
+	for(bin = 0; bin < ISR_STATS_BINS; bin++)
+	{
+		if(s.hist[bin] == 0)
+			continue;
+		if(bin == ISR_STATS_BINS - 1)
+			snprintf(str, sizeof(str), ">=%lu: %lu\n\r",
+					 (unsigned long)ISR_STATS_FIRST_BIN << (bin - 1), (unsigned long)s.hist[bin]);
+		else
+			snprintf(str, sizeof(str), "<%lu: %lu\n\r",
+					 (unsigned long)ISR_STATS_FIRST_BIN << bin, (unsigned long)s.hist[bin]);
+		UART_Print(str);
+	}
+}
+
+//--------------------------------------------------------------
+// @brief Function copies a stat without masking the interrupts
+// @details A handler that records during the copy changes count, the copy is made
+//			again then. A stat that is cleared but not recorded since is empty.
+//--------------------------------------------------------------
+static void statCopy(uint8_t stat, ISR_STAT_S *s)
+{
+	uint32_t count;
+
+	do
+	{
+		count = isr_stats[stat].count;
+		*s = isr_stats[stat];
+	}
+	while(count != isr_stats[stat].count);
+
+	if(s->clear)
+		memset(s, 0, sizeof(*s));
+}
+
+#endif
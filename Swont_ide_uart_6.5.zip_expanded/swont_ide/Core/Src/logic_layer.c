@@ -8,50 +8,175 @@
 #include "logic_layer.h"
 #include "main.h"
 #include "usart.h"
+#include "isr_stats.h"
+#include <stddef.h>
 
 
-char rood[4] = "rood";
-char blauw[5] = "blauw";
-char zwart[5] = "zwart";
-char lblauw[10] = "lichtblauw";
-char groen[5] = "groen";
-char lgroen[10] = "lichtgroen";
-char cyaan[5] = "cyaan";
-char lcyaan[10] = "lichtcyaan";
-char lrood[9] = "lichtrood";
-char magenta[7] = "magenta";
-char lmagenta[12] = "lichtmagenta";
-char bruin[5] = "bruin";
-char geel[4] = "geel";
-char grijs[5] = "grijs";
-char wit[3] = "wit";
-
-char consolas[] = "consolas", ariel[] = "ariel";
-char normaal[] = "normaal" , vet[] = "vet", cursief[] = "cursief";
-
-int color_check(char color[12]);
-int style_check(char stl[7]);
-int font_check(char fnt[8]);
+typedef struct
+{
+	const char *name;
+	uint8_t code;
+}NAME_S;
+
+// The name tables are sorted on name for the binary search in find_name
+static const NAME_S colors[] =
+{
+	{"blauw", VGA_COL_BLUE},
+	{"bruin", VGA_COL_BROWN},
+	{"cyaan", VGA_COL_CYAN},
+	{"geel", VGA_COL_YELLOW},
+	{"grijs", VGA_COL_GRAY},
+	{"groen", VGA_COL_GREEN},
+	{"lichtblauw", VGA_COL_LIGHTBLUE},
+	{"lichtcyaan", VGA_COL_LIGHTCYAN},
+	{"lichtgroen", VGA_COL_LIGHTGREEN},
+	{"lichtmagenta", VGA_COL_LIGHTMAGENTA},
+	{"lichtrood", VGA_COL_LIGHTRED},
+	{"magenta", VGA_COL_MAGENTA},
+	{"rood", VGA_COL_RED},
+	{"wit", VGA_COL_WHITE},
+	{"zwart", VGA_COL_BLACK},
+};
+
+static const NAME_S fonts[] =
+{
+	{"arial", ARIAL_FONT},
+	{"ariel", ARIAL_FONT},
+	{"consolas", CONSOLAS_FONT},
+};
+
+static const NAME_S styles[] =
+{
+	{"cursief", CURSIVE_STYLE},
+	{"normaal", NORMAL_STYLE},
+	{"vet", BOLD_STYLE},
+};
+
+static const NAME_S modes[] =
+{
+	{"160x120x8", VGA_MODE_160x120x8},
+	{"320x240x4", VGA_MODE_320x240x4},
+	{"320x240x8", VGA_MODE_320x240x8},
+	{"320x480x4", VGA_MODE_320x480x4},
+	{"40x30", VGA_MODE_40x30},
+	{"640x480x1", VGA_MODE_640x480x1},
+	{"80x30", VGA_MODE_80x30},
+};
+
+static uint8_t batch_buf[BATCH_BUFLEN];	//recorded functions: function, struct size, struct
+static uint16_t batch_len;				//used bytes of batch_buf
+static bool batch_open;					//true between begin and commit, or record and save
+static bool batch_macro;				//true when the batch is recorded for a macro
+static char batch_name[MACRO_NAMELEN];	//the name of the macro
+
+static int find_name(const NAME_S *table, uint8_t count, const char *name);
+static void draw(void);
+static uint8_t *batch_struct(char function, uint16_t *size);
+static void batch_record(void);
+static void batch_drop(void);
+static void batch_replay(const uint8_t *buf, uint16_t len);
+static void macro_play(void);
 
 //--------------------------------------------------------------
 // @brief Logic function.
 // @details This function conects the frond layer with the io layer.
-//
-// @param[in] x: The X-coordinate of the top left corner of the bitmap
-// @param[in] y: The Y-coordinate of the top left corner of the bitmap
-// @param[in] bmNr: The number ID of the bitmap to be loaded in
+//			It draws the function FL_Input loaded last (fl_function), the colors,
+//			font and style in the structs are already converted to codes.
+//			Between begin and commit the functions are recorded instead, commit draws
+//			them all at once, starting at the vertical blank.
+//			Between record and save the functions are recorded too, save stores them
+//			in flash as a macro that play draws again.
+//			mode is never recorded, a batch that is open is dropped with the screen.
+//			stats and histogram are never recorded either.
 //--------------------------------------------------------------
 void logic()
 {
+	int mode;
+
+	switch(fl_function)
+	{
+		case batchBegin:
+		case macroRecord:
+			if((fl_function == macroRecord) && (macro_s.name[0] == '\0'))
+			{
+				UART_Print("Error: no macro name\n\r");
+				break;
+			}
+			if(batch_open == true)
+				UART_Print("Warning: begin without commit, the batch starts again\n\r");
+			batch_open = true;
+			batch_macro = (fl_function == macroRecord);
+			batch_len = 0;
+			strcpy(batch_name, macro_s.name);
+			break;
+		case batchCommit:
+			if((batch_open == false) || (batch_macro == true))
+			{
+				UART_Print("Error: commit without begin\n\r");
+				break;
+			}
+			batch_replay(batch_buf, batch_len);
+			batch_open = false;
+			break;
+		case macroSave:
+			if((batch_open == false) || (batch_macro == false))
+			{
+				UART_Print("Error: save without record\n\r");
+				break;
+			}
+			MACRO_Save(batch_name, batch_buf, batch_len);
+			batch_open = false;
+			break;
+		case macroPlay:
+			macro_play();
+			break;
+		case macroList:
+			MACRO_List();
+			break;
+		case macroErase:
+			MACRO_Erase(macro_s.name);
+			break;
+		case videoMode:
+			mode = mode_check(mode_s.name);
+			if(mode < 0)
+				break;
+			if(batch_open == true)
+			{
+				UART_Print("Warning: mode without commit, the batch is dropped\n\r");
+				batch_open = false;
+			}
+			UB_VGA_SetMode(mode);
+			break;
+#if ISR_STATS
+		case isrStats:
+			ISR_STATS_Print();
+			break;
+		case isrHistogram:
+			ISR_STATS_Histogram(histogram_s.name);
+			break;
+#endif
+		default:
+			if(batch_open == true)
+				batch_record();
+			else
+				draw();
+			break;
+	}
+}
 
-	switch(input.byte_buffer_rx[firstCharacter])
+//--------------------------------------------------------------
+// @brief Function draws the function in fl_function
+//--------------------------------------------------------------
+static void draw(void)
+{
+	switch(fl_function)
 	{
 		case line:
 			 UB_VGA_SetLine(line_s.x1,
 							 line_s.y1,
 							 line_s.x2,
 							 line_s.y2,
-							 color_check(line_s.color),
+							 line_s.color,
 							 line_s.weight);
 			 break;
 		case rectangle:
@@ -59,7 +184,7 @@ void logic()
 					rectangle_s.ylup,
 					rectangle_s.width,
 					rectangle_s.height,
-					color_check(rectangle_s.color),
+					rectangle_s.color,
 					rectangle_s.filled,
 					rectangle_s.bordercolor,
 					rectangle_s.linewidth);
@@ -67,93 +192,256 @@ void logic()
 		case text:
 			UB_VGA_writeText(text_s.xlup,
 					text_s.ylup,
-					color_check(text_s.color),
+					text_s.color,
 					text_s.textin,
-					font_check(text_s.fontname),
+					text_s.fontname,
 					text_s.fontsize,
-					style_check(text_s.fontstyle));
+					text_s.fontstyle);
 			break;
 		case bitmap:
-			UB_VGA_DrawBitmap(bitmap_s.nr,
-					bitmap_s.xlup,
-					bitmap_s.ylup);
+			UB_VGA_DrawBitmap(bitmap_s.xlup,
+					bitmap_s.ylup,
+					bitmap_s.nr,
+					VGA_COL_BLACK,
+					0);
 			break;
 		case clearscreen:
-			UB_VGA_clearScreen(color_check(clearscreen_s.color));
+			UB_VGA_FillScreen(clearscreen_s.color);
+			break;
+		case spriteSet:
+			if(sprite_s.nr >= VGA_SPRITE_MAX)
+				UART_Print("Error: wrong sprite\n\r");
+			else
+				UB_VGA_SetSprite(sprite_s.nr, sprite_s.bm, sprite_s.color, sprite_s.z);
+			break;
+		case spriteMove:
+			UB_VGA_MoveSprite(move_s.nr, move_s.x, move_s.y);
 			break;
 		default:
-			HAL_UART_Transmit(&huart2, (uint8_t *)"no comando\n\r", sizeof("no comando"),100);
+			UART_Print("no comando\n\r");
 			break;
 	}
 }
 
-
 //--------------------------------------------------------------
-// @brief Function check font type.
-// @details This function checks which font is askt.
+// @brief Function gives the struct of a function
 //
-// @param[in] fnt: char whit font type
+// @param[in] function: The function (fl_function)
+// @param[out] size: The size of the struct
 //
-// @return return font type as 1 or 2
+// @return the struct, NULL when the function has none
 //--------------------------------------------------------------
-int font_check(char fnt[8])
+static uint8_t *batch_struct(char function, uint16_t *size)
 {
-	int font;
-	uint8_t result;
-
-	result = strcmp(fnt, ariel);
-	if (result == 0)
+	switch(function)
 	{
-		font = 1;
+		case line:
+			*size = sizeof(line_s);
+			return (uint8_t *)&line_s;
+		case rectangle:
+			*size = sizeof(rectangle_s);
+			return (uint8_t *)&rectangle_s;
+		case text:
+			*size = sizeof(text_s);
+			return (uint8_t *)&text_s;
+		case bitmap:
+			*size = sizeof(bitmap_s);
+			return (uint8_t *)&bitmap_s;
+		case clearscreen:
+			*size = sizeof(clearscreen_s);
+			return (uint8_t *)&clearscreen_s;
+		case spriteSet:
+			*size = sizeof(sprite_s);
+			return (uint8_t *)&sprite_s;
+		case spriteMove:
+			*size = sizeof(move_s);
+			return (uint8_t *)&move_s;
+		default:
+			return NULL;
 	}
-	result = strcmp(fnt, consolas);
-	if (result == 0)
+}
+
+//--------------------------------------------------------------
+// @brief Function records the function in fl_function in the batch
+// @details A clearscreen draws over the whole screen, so the functions recorded
+//			before it are dropped, except the sprites (see batch_drop).
+//			A function that doesn't fit is dropped with an error.
+//--------------------------------------------------------------
+static void batch_record(void)
+{
+	uint8_t *s;
+	uint16_t size;
+
+	s = batch_struct(fl_function, &size);
+	if(s == NULL)
 	{
-		font = 2;
+		UART_Print("no comando\n\r");
+		return;
 	}
-	else
+	if(fl_function == text)
+		size = offsetof(TEXT_S, textin) + strlen(text_s.textin) + 1;	//only the used part of textin
+	if(fl_function == clearscreen)
+		batch_drop();
+	if(batch_len + 2 + size > BATCH_BUFLEN)
 	{
-		HAL_UART_Transmit(&huart2, (uint8_t *)"wrong font\n\r", sizeof("wrong font"),100);
+		UART_Print("Error: batch full, function dropped\n\r");
+		return;
 	}
 
+	batch_buf[batch_len++] = fl_function;
+	batch_buf[batch_len++] = size;
+	memcpy(&batch_buf[batch_len], s, size);
+	batch_len += size;
+}
 
+//--------------------------------------------------------------
+// @brief Function drops the recorded functions a clearscreen draws over
+// @details The sprites are not in the picture, their functions stay in the batch.
+//--------------------------------------------------------------
+static void batch_drop(void)
+{
+	uint16_t pos = 0;
+	uint16_t len = 0;
+	uint16_t size;
 
-	return font;
+	while(pos < batch_len)
+	{
+		size = 2 + batch_buf[pos + 1];
+		if((batch_buf[pos] == spriteSet) || (batch_buf[pos] == spriteMove))
+		{
+			memmove(&batch_buf[len], &batch_buf[pos], size);
+			len += size;
+		}
+		pos += size;
+	}
+	batch_len = len;
 }
 
 //--------------------------------------------------------------
-// @brief Function check font style.
-// @details This function looks which font style should be displayd (normaal, vet, cursief).
+// @brief Function draws recorded functions
+// @details Drawing starts at the vertical blank, so a batch that fits in the blank is
+//			never shown half drawn. With two buffers the batch is drawn into the hidden
+//			buffer and shown by the next UB_VGA_Swap.
+//			A macro from flash is checked like the rest, it stops at a damaged record.
 //
-// @param[in] the char withe the fond style in it
-//
-// @return return the style code (1,2,3) 1 = normaal, 2 = vet, 3 = cursief
+// @param[in] buf: The recorded functions, in batch_buf or in flash
+// @param[in] len: The amount of bytes in buf
 //--------------------------------------------------------------
-int style_check(char stl[7])
+static void batch_replay(const uint8_t *buf, uint16_t len)
 {
-	int style;
-	uint8_t result;
+	uint16_t pos = 0;
+	uint16_t size;
+	uint8_t *s;
 
-	result = strcmp(stl, normaal);
-	if (result == 0)
+	UB_VGA_WaitVBlank();
+	while(pos + 2 <= len)
 	{
-		style = 1;
+		fl_function = buf[pos];
+		s = batch_struct(fl_function, &size);
+		if((s == NULL) || (buf[pos + 1] > size) || (pos + 2 + buf[pos + 1] > len))
+			break;
+		size = buf[pos + 1];
+		memcpy(s, &buf[pos + 2], size);
+		draw();
+		pos += 2 + size;
 	}
-	result = strcmp(stl, vet);
-	if (result == 0)
+}
+
+//--------------------------------------------------------------
+// @brief Function draws the macro in macro_s
+// @details Inside a batch or a recording the functions of the macro are recorded instead.
+//--------------------------------------------------------------
+static void macro_play(void)
+{
+	const uint8_t *data;
+	uint16_t len;
+
+	if(macro_s.name[0] != '\0')
+		data = MACRO_Find(macro_s.name, &len);
+	else
+		data = MACRO_Get(macro_s.nr, &len);
+	if(data == NULL)
 	{
-		style = 2;
+		UART_Print("Error: unknown macro\n\r");
+		return;
 	}
-	result = strcmp(stl, cursief);
-	if (result == 0)
+
+	if(batch_open == false)
 	{
-		style = 3;
+		batch_replay(data, len);
+		return;
 	}
-	else
+	if(batch_len + len > BATCH_BUFLEN)
+	{
+		UART_Print("Error: batch full, function dropped\n\r");
+		return;
+	}
+	memcpy(&batch_buf[batch_len], data, len);
+	batch_len += len;
+}
+
+//--------------------------------------------------------------
+// @brief Function looks up a name in a sorted name table
+// @details Binary search, so a name costs at most 4 string compares in the color table.
+//
+// @param[in] table: The name table, sorted on name
+// @param[in] count: The amount of names in the table
+// @param[in] name: The name to look up
+//
+// @return the code of the name, -1 when the name is not in the table
+//--------------------------------------------------------------
+static int find_name(const NAME_S *table, uint8_t count, const char *name)
+{
+	uint8_t low = 0;
+	uint8_t high = count;
+	uint8_t mid;
+	int result;
+
+	while(low < high)
 	{
-		HAL_UART_Transmit(&huart2, (uint8_t *)"wrong style\n\r", sizeof("wrong style"),100);
+		mid = (low + high) / 2;
+		result = strcmp(name, table[mid].name);
+		if(result == 0)
+			return table[mid].code;
+		if(result < 0)
+			high = mid;
+		else
+			low = mid + 1;
 	}
+	return -1;
+}
+
+//--------------------------------------------------------------
+// @brief Function check font type.
+// @details This function checks which font is askt.
+//
+// @param[in] fnt: char whit font type
+//
+// @return return font type as 1 or 2, -1 when the font is unknown
+//--------------------------------------------------------------
+int font_check(const char *fnt)
+{
+	int font = find_name(fonts, sizeof(fonts) / sizeof(fonts[0]), fnt);
+
+	if(font < 0)
+		UART_Print("wrong font\n\r");
+	return font;
+}
 
+//--------------------------------------------------------------
+// @brief Function check font style.
+// @details This function looks which font style should be displayd (normaal, vet, cursief).
+//
+// @param[in] the char withe the fond style in it
+//
+// @return return the style code (1,2,3) 1 = normaal, 2 = vet, 3 = cursief, -1 when the style is unknown
+//--------------------------------------------------------------
+int style_check(const char *stl)
+{
+	int style = find_name(styles, sizeof(styles) / sizeof(styles[0]), stl);
+
+	if(style < 0)
+		UART_Print("wrong style\n\r");
 	return style;
 }
 
@@ -163,172 +451,31 @@ int style_check(char stl[7])
 //
 // @param[in] color: char with the color
 //
-// @return return the color code
+// @return return the color code, -1 when the color is unknown
 //--------------------------------------------------------------
-int color_check(char color[12])
+int color_check(const char *color)
 {
-		int ret_val;
-		uint8_t result;
-		result = 1;
-		switch(color[0])
-		{
-		case 'z':
-			result = strcmp(color, zwart);
-			if (result == 0)
-			{
-			ret_val = VGA_COL_BLACK;
-			result = 1;
-			}
-			else
-			{
-				HAL_UART_Transmit(&huart2, (uint8_t *)"wrong color\n\r", sizeof("wrong color"),100);
-			}
-		case 'l':
-			switch(color[5])
-			{
-			case 'b':
-				result = strcmp(color, lblauw);
-				if (result == 0)
-				{
-				ret_val = VGA_COL_LIGHTBLUE;
-				result = 1;
-				}
-				else
-				{
-					HAL_UART_Transmit(&huart2, (uint8_t *)"wrong color\n\r", sizeof("wrong color"),100);
-				}
-			case 'g':
-				result = strcmp(color, lgroen);
-				if (result == 0)
-				{
-				ret_val = VGA_COL_LIGHTGREEN;
-				result = 1;
-				}
-				else
-				{
-					HAL_UART_Transmit(&huart2, (uint8_t *)"wrong color\n\r", sizeof("wrong color"),100);
-				}
-			case 'r':
-				result = strcmp(color, lrood);
-				if (result == 0)
-				{
-				ret_val = VGA_COL_LIGHTRED;
-				result = 1;
-				}
-				else
-				{
-					HAL_UART_Transmit(&huart2, (uint8_t *)"wrong color\n\r", sizeof("wrong color"),100);
-				}
-			case 'c':
-				result = strcmp(color, lcyaan);
-				if (result == 0)
-				{
-				ret_val = VGA_COL_LIGHTCYAN;
-				result = 1;
-				}
-				else
-				{
-					HAL_UART_Transmit(&huart2, (uint8_t *)"wrong color\n\r", sizeof("wrong color"),100);
-				}
-			case 'm':
-				result = strcmp(color, lmagenta);
-				if (result == 0)
-				{
-				ret_val = VGA_COL_LIGHTMAGENTA;
-				result = 1;
-				}
-				else
-				{
-					HAL_UART_Transmit(&huart2, (uint8_t *)"wrong color\n\r", sizeof("wrong color"),100);
-				}
-			}
-		case 'r':
-			result = strcmp(color, rood);
-			if (result == 0)
-			{
-			ret_val = VGA_COL_RED;
-			result = 1;
-			}
-			else
-			{
-				HAL_UART_Transmit(&huart2, (uint8_t *)"wrong color\n\r", sizeof("wrong color"),100);
-			}
-		case 'w':
-			result = strcmp(color, wit);
-			if (result == 0)
-			{
-			ret_val = VGA_COL_WHITE;
-			result = 1;
-			}
-			else
-			{
-				HAL_UART_Transmit(&huart2, (uint8_t *)"wrong color\n\r", sizeof("wrong color"),100);
-			}
-		case 'g':
-			result = strcmp(color, geel);
-			if (result == 0)
-			{
-			ret_val = VGA_COL_YELLOW;
-			result = 1;
-			}
-			result = strcmp(color, grijs);
-			if (result == 0)
-			{
-			ret_val = VGA_COL_GRAY;
-			result = 1;
-			}
-			result = strcmp(color, groen);
-
-			if (result == 0)
-			{
-			ret_val = VGA_COL_GREEN;
-			result = 1;
-			}
-			else
-			{
-				HAL_UART_Transmit(&huart2, (uint8_t *)"wrong color\n\r", sizeof("wrong color"),100);
-			}
-		case 'c':
-			result = strcmp(color, cyaan);
-			if (result == 0)
-			{
-			ret_val = VGA_COL_CYAN;
-			result = 1;
-			}
-			else
-			{
-				HAL_UART_Transmit(&huart2, (uint8_t *)"wrong color\n\r", sizeof("wrong color"),100);
-			}
-		case 'm':
-			result = strcmp(color, magenta);
-			if (result == 0)
-			{
-			ret_val = VGA_COL_MAGENTA;
-			result = 1;
-			}
-			else
-			{
-				HAL_UART_Transmit(&huart2, (uint8_t *)"wrong color\n\r", sizeof("wrong color"),100);
-			}
-		case 'b':
-			result = strcmp(color, blauw);
-			if (result == 0)
-			{
-			ret_val = VGA_COL_BLUE;
-			result = 1;
-			}
-			result = strcmp(color, bruin);
-			if (result == 0)
-			{
-			ret_val = VGA_COL_BROWN;
-			result = 1;
-			}
-			else
-			{
-				HAL_UART_Transmit(&huart2, (uint8_t *)"wrong color\n\r", sizeof("wrong color"),100);
-			}
-		}
+	int code = find_name(colors, sizeof(colors) / sizeof(colors[0]), color);
 
-	return ret_val;
+	if(code < 0)
+		UART_Print("wrong color\n\r");
+	return code;
 }
 
+//--------------------------------------------------------------
+// @brief Function checks the video mode.
+// @details The name is width x height x bits per pixel, e.g. 320x240x8,
+//			or columns x rows for the text modes (80x30, 40x30).
+//
+// @param[in] mode: char with the mode name
+//
+// @return return the mode, VGA_MODE_..., -1 when the mode is unknown
+//--------------------------------------------------------------
+int mode_check(const char *mode)
+{
+	int code = find_name(modes, sizeof(modes) / sizeof(modes[0]), mode);
+
+	if(code < 0)
+		UART_Print("wrong mode\n\r");
+	return code;
+}
@@ -0,0 +1,256 @@
+/*
+ * macro.c
+ *
+ *  Created on: 17 okt. 2026
+ */
+#include "macro.h"
+#include "usart.h"
+
+// A macro in flash: the header followed by len bytes of recorded functions (see logic_layer.c),
+// padded to a whole word. Macros are only appended, so their numbers don't change until the
+// sector is erased. Bits in flash can only be cleared, so erasing one macro clears its erased field.
+typedef struct
+{
+	uint32_t magic;				//MACRO_MAGIC, 0xFFFFFFFF = free flash
+	uint32_t erased;			//0xFFFFFFFF = valid, 0 = erased
+	char name[MACRO_NAMELEN];
+	uint32_t len;				//bytes of recorded functions after the header
+}MACRO_HEADER_S;
+
+#define MACRO_SIZE(len) ((sizeof(MACRO_HEADER_S) + (len) + 3) & ~3u)
+
+static const MACRO_HEADER_S *macroAt(uint32_t adr);
+static const MACRO_HEADER_S *macroFind(const char *name);
+static uint32_t macroEnd(void);
+static bool macroProgram(uint32_t adr, const uint8_t *data, uint32_t len);
+static void macroFlushCache(void);
+
+//--------------------------------------------------------------
+// @brief Function stores a macro
+// @details A macro with the same name is replaced. The flash is written with the CPU
+//			stalled, this takes a few ms per KB and can disturb a few frames.
+//
+// @param[in] name: The name of the macro
+// @param[in] data: The recorded functions
+// @param[in] len: The amount of bytes in data
+//
+// @return true when the macro is stored
+//--------------------------------------------------------------
+bool MACRO_Save(const char *name, const uint8_t *data, uint16_t len)
+{
+	MACRO_HEADER_S header;
+	const MACRO_HEADER_S *old = macroFind(name);
+	uint32_t adr = macroEnd();
+	uint32_t erased = 0;
+	bool ok;
+
+	if((adr + MACRO_SIZE(len) > MACRO_END) || (*(const uint32_t *)adr != 0xFFFFFFFF))
+	{
+		UART_Print("Error: macro store full, erase it with erase,*\n\r");
+		return false;
+	}
+
+	memset(&header, 0xFF, sizeof(header));
+	header.magic = MACRO_MAGIC;
+	strncpy(header.name, name, MACRO_NAMELEN - 1);
+	header.name[MACRO_NAMELEN - 1] = '\0';
+	header.len = len;
+
+	HAL_FLASH_Unlock();
+	ok = macroProgram(adr, (const uint8_t *)&header, sizeof(header)) &&
+		 macroProgram(adr + sizeof(header), data, len);
+	if(ok && (old != NULL))
+		ok = macroProgram((uint32_t)&old->erased, (const uint8_t *)&erased, sizeof(erased));
+	HAL_FLASH_Lock();
+	macroFlushCache();
+
+	if(ok == false)
+		UART_Print("Error: writing the macro failed\n\r");
+	return ok;
+}
+
+//--------------------------------------------------------------
+// @brief Function looks up a macro by name
+//
+// @param[in] name: The name of the macro
+// @param[out] len: The amount of bytes of recorded functions
+//
+// @return the recorded functions in flash, NULL when there is no such macro
+//--------------------------------------------------------------
+const uint8_t *MACRO_Find(const char *name, uint16_t *len)
+{
+	const MACRO_HEADER_S *m = macroFind(name);
+
+	if(m == NULL)
+		return NULL;
+	*len = m->len;
+	return (const uint8_t *)(m + 1);
+}
+
+//--------------------------------------------------------------
+// @brief Function looks up a macro by number
+// @details The number is the position in the flash sector, as shown by MACRO_List.
+//
+// @param[in] nr: The number of the macro
+// @param[out] len: The amount of bytes of recorded functions
+//
+// @return the recorded functions in flash, NULL when there is no such macro
+//--------------------------------------------------------------
+const uint8_t *MACRO_Get(uint8_t nr, uint16_t *len)
+{
+	const MACRO_HEADER_S *m;
+	uint32_t adr = MACRO_START;
+
+	while((m = macroAt(adr)) != NULL)
+	{
+		if(nr-- == 0)
+		{
+			if(m->erased == 0)
+				return NULL;
+			*len = m->len;
+			return (const uint8_t *)(m + 1);
+		}
+		adr += MACRO_SIZE(m->len);
+	}
+	return NULL;
+}
+
+//--------------------------------------------------------------
+// @brief Function erases a macro
+// @details "*" erases the whole flash sector. This stalls the CPU for 1-2 seconds,
+//			the picture is lost meanwhile.
+//
+// @param[in] name: The name of the macro, or "*" for all macros
+//
+// @return true when the macro is erased
+//--------------------------------------------------------------
+bool MACRO_Erase(const char *name)
+{
+	FLASH_EraseInitTypeDef erase = {0};
+	const MACRO_HEADER_S *m;
+	uint32_t error = 0;
+	uint32_t erased = 0;
+	bool ok;
+
+	HAL_FLASH_Unlock();
+	if(strcmp(name, "*") == 0)
+	{
+		erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+		erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+		erase.Sector = MACRO_SECTOR;
+		erase.NbSectors = 1;
+		ok = (HAL_FLASHEx_Erase(&erase, &error) == HAL_OK);
+	}
+	else
+	{
+		m = macroFind(name);
+		ok = (m != NULL) && macroProgram((uint32_t)&m->erased, (const uint8_t *)&erased, sizeof(erased));
+	}
+	HAL_FLASH_Lock();
+	macroFlushCache();
+
+	if(ok == false)
+		UART_Print("Error: unknown macro\n\r");
+	return ok;
+}
+
+//--------------------------------------------------------------
+// @brief Function prints the stored macros
+// @details One line per macro: number, name and size, then the free flash.
+//--------------------------------------------------------------
+void MACRO_List(void)
+{
+	const MACRO_HEADER_S *m;
+	uint32_t adr = MACRO_START;
+	uint8_t nr = 0;
+
+	while((m = macroAt(adr)) != NULL)
+	{
+		if(m->erased != 0)
+			printf("%u: %s, %lu bytes\n\r", nr, m->name, (unsigned long)m->len);
+		adr += MACRO_SIZE(m->len);
+		nr++;
+	}
+	printf("%lu bytes free\n\r", (unsigned long)(MACRO_END - adr));
+}
+
+//--------------------------------------------------------------
+// @brief Function reads the macro header at an address
+//
+// @return the header, NULL when there is no (complete) macro
+//--------------------------------------------------------------
+static const MACRO_HEADER_S *macroAt(uint32_t adr)
+{
+	const MACRO_HEADER_S *m = (const MACRO_HEADER_S *)adr;
+
+	if((adr + sizeof(MACRO_HEADER_S) > MACRO_END) || (m->magic != MACRO_MAGIC) ||
+	   (m->len > MACRO_END - adr - sizeof(MACRO_HEADER_S)))
+		return NULL;
+	return m;
+}
+
+//--------------------------------------------------------------
+// @brief Function looks up the header of a valid macro by name
+//--------------------------------------------------------------
+static const MACRO_HEADER_S *macroFind(const char *name)
+{
+	const MACRO_HEADER_S *m;
+	uint32_t adr = MACRO_START;
+
+	while((m = macroAt(adr)) != NULL)
+	{
+		if((m->erased != 0) && (strncmp(m->name, name, MACRO_NAMELEN) == 0))
+			return m;
+		adr += MACRO_SIZE(m->len);
+	}
+	return NULL;
+}
+
+//--------------------------------------------------------------
+// @brief Function gives the address after the last macro
+//--------------------------------------------------------------
+static uint32_t macroEnd(void)
+{
+	const MACRO_HEADER_S *m;
+	uint32_t adr = MACRO_START;
+
+	while((m = macroAt(adr)) != NULL)
+		adr += MACRO_SIZE(m->len);
+	return adr;
+}
+
+//--------------------------------------------------------------
+// @brief Function writes bytes to erased flash, a word at a time
+// @details The last word is padded with 0xFF. The flash has to be unlocked.
+//
+// @return false when the flash reports an error
+//--------------------------------------------------------------
+static bool macroProgram(uint32_t adr, const uint8_t *data, uint32_t len)
+{
+	uint32_t word;
+	uint32_t n;
+
+	while(len > 0)
+	{
+		n = (len < sizeof(word)) ? len : sizeof(word);
+		word = 0xFFFFFFFF;
+		memcpy(&word, data, n);
+		if(HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, adr, word) != HAL_OK)
+			return false;
+		adr += sizeof(word);
+		data += n;
+		len -= n;
+	}
+	return true;
+}
+
+//--------------------------------------------------------------
+// @brief Function resets the flash data cache
+// @details It can still hold the sector as it was before the write.
+//--------------------------------------------------------------
+static void macroFlushCache(void)
+{
+	__HAL_FLASH_DATA_CACHE_DISABLE();
+	__HAL_FLASH_DATA_CACHE_RESET();
+	__HAL_FLASH_DATA_CACHE_ENABLE();
+}
@@ -25,6 +25,7 @@
 #include "gpio.h"
 #include "Frontlayer.h"
 #include "logic_layer.h"
+#include "isr_stats.h"
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
@@ -98,10 +99,11 @@ int main(void)
   MX_DMA_Init();
   MX_TIM1_Init();
   MX_TIM2_Init();
+  MX_TIM3_Init();
   MX_USART2_UART_Init();
-  Bitmap_init();
   /* USER CODE BEGIN 2 */
 
+  ISR_STATS_Init(); // the cycle counter, before the interrupts start
   UB_VGA_Screen_Init(); // Init VGA-Screen
 
   UB_VGA_FillScreen(VGA_COL_WHITE);
@@ -141,17 +143,13 @@ int main(void)
 
 //  	  UB_VGA_DrawBitmap(100, 100, 'a', 1, 1);
 
-  for(i = 0; i < LINE_BUFLEN; i++)
-	  input.line_rx_buffer[i] = 0;
-
   // Reset some stuff
-  input.byte_buffer_rx[0] = 0;
   input.char_counter = 0;
-  input.command_execute_flag = FALSE;
-  // HAl wants a memory location to store the charachter it receives from the UART
-  // We will pass it an array, but we will not use it. We declare our own variable in the interupt handler
-  // See stm32f4xx_it.c
-  HAL_UART_Receive_IT(&huart2, input.byte_buffer_rx, BYTE_BUFLEN);
+  input.queue_head = 0;
+  input.queue_tail = 0;
+  // The DMA receives the bytes, the interrupts only come per chunk
+  // See UART_RxStart in usart.c
+  UART_RxStart();
 
   // Test to see if the screen reacts to UART
 
@@ -162,13 +160,22 @@ int main(void)
   while (1)
   {
 //	  UB_VGA_SetPixel(160,120,VGA_COL_RED);
-	  if(input.command_execute_flag == TRUE)
+	  if(UART_GetLine() == TRUE)
 	  {
-		  // jump to parser
-		  FL_Input();
-		  logic();
-		  // When finished reset the flag
-		  input.command_execute_flag = FALSE;
+		  // handle all queued lines, the UART keeps filling the queue meanwhile
+		  UB_VGA_StartDraw();
+		  do
+		  {
+			  // jump to parser, a binary frame can hold several functions
+			  while(FL_Input() == true)
+				  logic();
+			  // When finished give the slot back
+			  UART_ReleaseLine();
+		  }
+		  while(UART_GetLine() == TRUE);
+
+		  // two buffers: show the result in the next frame, doesn't wait for it
+		  UB_VGA_Swap();
 	  }
     /* USER CODE END WHILE */
 
@@ -231,10 +238,18 @@ void SystemClock_Config(void)
 //Retargets the C library printf function to the USART
 USART_PRINTF
 {
-	HAL_UART_Transmit(&huart2, (uint8_t *)&ch, 1, 0xFFFF);	//Write character to UART2
+	uint8_t c = ch;
+	UART_Send(&c, 1);										//Queue character for UART2, never waits
 	return ch;												//Return the character
 }
 
+//printf hands its whole buffer over at once
+int _write(int file, char *ptr, int len)
+{
+	UART_Send((uint8_t *)ptr, len);
+	return len;
+}
+
 /* USER CODE END 4 */
 
 /**
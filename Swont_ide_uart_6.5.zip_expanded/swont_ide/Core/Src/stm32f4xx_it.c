@@ -23,6 +23,8 @@
 #include "stm32f4xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "usart.h"
+#include "isr_stats.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -56,8 +58,10 @@
 /* USER CODE END 0 */
 
 /* External variables --------------------------------------------------------*/
-extern DMA_HandleTypeDef hdma_tim1_up;
 extern TIM_HandleTypeDef htim2;
+extern TIM_HandleTypeDef htim3;
+extern DMA_HandleTypeDef hdma_usart2_rx;
+extern DMA_HandleTypeDef hdma_usart2_tx;
 extern UART_HandleTypeDef huart2;
 /* USER CODE BEGIN EV */
 extern TIM_HandleTypeDef htim1;
@@ -199,13 +203,45 @@ void SysTick_Handler(void)
 /* please refer to the startup file (startup_stm32f4xx.s).                    */
 /******************************************************************************/
 
+/**
+  * @brief This function handles DMA1 stream5 global interrupt.
+  */
+void DMA1_Stream5_IRQHandler(void)
+{
+  /* USER CODE BEGIN DMA1_Stream5_IRQn 0 */
+
+  /* USER CODE END DMA1_Stream5_IRQn 0 */
+  HAL_DMA_IRQHandler(&hdma_usart2_rx);
+  /* USER CODE BEGIN DMA1_Stream5_IRQn 1 */
+
+  /* USER CODE END DMA1_Stream5_IRQn 1 */
+}
+
+/**
+  * @brief This function handles DMA1 stream6 global interrupt.
+  */
+void DMA1_Stream6_IRQHandler(void)
+{
+  /* USER CODE BEGIN DMA1_Stream6_IRQn 0 */
+
+  /* USER CODE END DMA1_Stream6_IRQn 0 */
+  HAL_DMA_IRQHandler(&hdma_usart2_tx);
+  /* USER CODE BEGIN DMA1_Stream6_IRQn 1 */
+
+  /* USER CODE END DMA1_Stream6_IRQn 1 */
+}
+
 /**
   * @brief This function handles TIM2 global interrupt.
   */
 void TIM2_IRQHandler(void)
 {
   /* USER CODE BEGIN TIM2_IRQn 0 */
-
+  uint16_t scan;
+  uint16_t row;
+  uint8_t *buf;
+  ISR_STATS_LATENCY(ISR_STAT_LATENCY, TIM2, TIM2->CCR3);
+  ISR_STATS_ENTER();
   /* USER CODE END TIM2_IRQn 0 */
   HAL_TIM_IRQHandler(&htim2);
   /* USER CODE BEGIN TIM2_IRQn 1 */
@@ -216,94 +252,98 @@ void TIM2_IRQHandler(void)
   {
     // -----------
     VGA.hsync_cnt = 0;
-    // Adresspointer first dot
-    VGA.start_adr = (uint32_t)(&VGA_RAM1[0]);
   }
 
   // HSync-Pixel
   GPIOB->BSRR = (VGA.hsync_cnt < VGA_VSYNC_IMP) ? VGA_VSYNC_Pin << 16u: VGA_VSYNC_Pin;
 
-  // Test for DMA start
+  // last line before the picture: the DMA starts over at the first row
+  if(VGA.hsync_cnt == VGA_VSYNC_BILD_START - 1)
+    UB_VGA_StartFrame();
+
+  // The DMA shows this line, TIM3 opens the gate of TIM1 in hardware
   if((VGA.hsync_cnt >= VGA_VSYNC_BILD_START) && (VGA.hsync_cnt <= VGA_VSYNC_BILD_STOP))
   {
-    // after FP start => DMA Transfer
-
-    // DMA2 init
-	  DMA2_Stream5->CR = VGA.dma2_cr_reg;
-    // set adress
-    DMA2_Stream5->M0AR = VGA.start_adr;
-    // Timer1 start
-    TIM1->CR1 |= TIM_CR1_CEN; // __HAL_TIM_ENABLE(&htim1); // too slow?
-    // DMA2 enable
-    __HAL_DMA_ENABLE(&hdma_tim1_up);
-    // Test Adrespointer for high
-    if(VGA.hsync_cnt & 0x01)
-      VGA.start_adr += (VGA_DISPLAY_X + 1); // inc after Hsync
+    // next line, absolute so a change of the video mode can't run off the buffer,
+    // every row is shown on 1 << VGA.row_shift lines
+    scan = VGA.hsync_cnt - VGA_VSYNC_BILD_START + 1;
+    row = scan >> VGA.row_shift;
+    if(VGA.hsync_cnt < VGA_VSYNC_BILD_STOP)
+    {
+      // a new row: expand it or draw the sprites while the DMA shows the other line buffer
+      if((scan & ((1 << VGA.row_shift) - 1)) == 0)
+        VGA.start_adr = UB_VGA_ScanLine(row);
+
+      // set adress, in the register the DMA doesn't read now
+      if(DMA2_Stream5->CR & DMA_SxCR_CT)
+        DMA2_Stream5->M0AR = VGA.start_adr;
+      else
+        DMA2_Stream5->M1AR = VGA.start_adr;
+    }
+
+    // end of the picture: the vertical blank starts
+    if(VGA.hsync_cnt == VGA_VSYNC_BILD_STOP)
+    {
+      // no gate from the next line on
+      TIM3->SMCR &= ~TIM_SMCR_SMS;
+      VGA.frame++;
+    }
   }
+
+  // modes with two buffers: show the new buffer from the next frame on, in any line of
+  // the vertical blank the main loop doesn't draw in (UB_VGA_StartDraw)
+  if(VGA.swap && !VGA.drawing &&
+     ((VGA.hsync_cnt >= VGA_VSYNC_BILD_STOP) || (VGA.hsync_cnt < VGA_VSYNC_BILD_START - 1)))
+  {
+    buf = VGA.show_buf;
+    VGA.show_buf = VGA.draw_buf;
+    VGA.draw_buf = buf;
+    VGA.swap = 0;
+  }
+  ISR_STATS_EXIT(ISR_STAT_TIM2);
   /* USER CODE END TIM2_IRQn 1 */
 }
 
+/**
+  * @brief This function handles TIM3 global interrupt.
+  */
+void TIM3_IRQHandler(void)
+{
+  /* USER CODE BEGIN TIM3_IRQn 0 */
+  ISR_STATS_ENTER();
+  /* USER CODE END TIM3_IRQn 0 */
+  HAL_TIM_IRQHandler(&htim3);
+  /* USER CODE BEGIN TIM3_IRQn 1 */
+  // end of the gate: the line is out, check the stream for the next one
+  UB_VGA_LineEnd();
+  ISR_STATS_EXIT(ISR_STAT_TIM3);
+  /* USER CODE END TIM3_IRQn 1 */
+}
+
 /**
   * @brief This function handles USART2 global interrupt.
   */
 void USART2_IRQHandler(void)
 {
   /* USER CODE BEGIN USART2_IRQn 0 */
+	ISR_STATS_ENTER();
 
-	// Store the byte we received on the UART
-	char uart_char = USART2->DR;
-
-	//Ignore the '\n' character
-	if(uart_char != LINE_FEED)
+	// The bytes are received by DMA, the line going idle ends a chunk.
+	// Reading SR and DR clears IDLE (and a stale overrun with it)
+	if(__HAL_UART_GET_FLAG(&huart2, UART_FLAG_IDLE))
 	{
-		// Check for CR or a dot
-		// There was a small bug in the terminal program.
-		// By terminating your message with a dot you can ignore the CR (Enter) character
-		if((uart_char == CARRIAGE_RETURN) || (uart_char == '.'))
-		{
-			input.command_execute_flag = TRUE;
-			// Store the message length for processing
-			input.msglen = input.char_counter;
-			// Reset the counter for the next line
-			input.char_counter = 0;
-			//Gently exit interrupt
-		}
-		else
-		{
-			input.command_execute_flag = FALSE;
-			input.line_rx_buffer[input.char_counter] = uart_char;
-			input.char_counter++;
-		}
+		__HAL_UART_CLEAR_IDLEFLAG(&huart2);
+		UART_RxIdle();
 	}
 
   /* USER CODE END USART2_IRQn 0 */
   HAL_UART_IRQHandler(&huart2);
   /* USER CODE BEGIN USART2_IRQn 1 */
+	ISR_STATS_EXIT(ISR_STAT_USART2);
 
   /* USER CODE END USART2_IRQn 1 */
 }
 
-/**
-  * @brief This function handles DMA2 stream5 global interrupt.
-  */
-void DMA2_Stream5_IRQHandler(void)
-{
-  /* USER CODE BEGIN DMA2_Stream5_IRQn 0 */
-
-    // Timer1 stop
-    __HAL_TIM_DISABLE(&htim1);
-    // DMA2 disable
-    // __HAL_DMA_DISABLE(&hdma_tim1_up); // not needed?
-    // switch on black
-    GPIOE->BSRR = VGA_GPIO_HINIBBLE << 16u;
-
-  /* USER CODE END DMA2_Stream5_IRQn 0 */
-  HAL_DMA_IRQHandler(&hdma_tim1_up);
-  /* USER CODE BEGIN DMA2_Stream5_IRQn 1 */
-
-  /* USER CODE END DMA2_Stream5_IRQn 1 */
-}
-
 /* USER CODE BEGIN 1 */
 
 /* USER CODE END 1 */
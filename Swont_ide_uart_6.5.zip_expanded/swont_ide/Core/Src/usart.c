@@ -21,10 +21,26 @@
 #include "usart.h"
 
 /* USER CODE BEGIN 0 */
+#include "Frontlayer.h"
 
+static void UART_RxDmaCallback(DMA_HandleTypeDef *hdma);
+static void UART_RxLine(const uint8_t *data, uint16_t len);
+static void UART_RxFrame(void);
+static void UART_QueueLine(void);
+static void UART_TxStart(void);
+static void UART_TxDmaCallback(DMA_HandleTypeDef *hdma);
+
+// Transmit ring: UART_Send moves tx_head, the DMA callback moves tx_tail
+static uint8_t tx_buffer[TX_BUFLEN];
+static volatile uint16_t tx_head;
+static volatile uint16_t tx_tail;
+static volatile uint16_t tx_busy;		// bytes the DMA is sending now, 0 = idle
+volatile uint32_t tx_dropped;			// bytes dropped because the ring was full
 /* USER CODE END 0 */
 
 UART_HandleTypeDef huart2;
+DMA_HandleTypeDef hdma_usart2_rx;
+DMA_HandleTypeDef hdma_usart2_tx;
 
 /* USART2 init function */
 
@@ -70,8 +86,45 @@ void HAL_UART_MspInit(UART_HandleTypeDef* uartHandle)
     GPIO_InitStruct.Alternate = GPIO_AF7_USART2;
     HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
 
+    /* USART2 DMA Init */
+    /* USART2_RX Init */
+    hdma_usart2_rx.Instance = DMA1_Stream5;
+    hdma_usart2_rx.Init.Channel = DMA_CHANNEL_4;
+    hdma_usart2_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    hdma_usart2_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma_usart2_rx.Init.MemInc = DMA_MINC_ENABLE;
+    hdma_usart2_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hdma_usart2_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    hdma_usart2_rx.Init.Mode = DMA_CIRCULAR;
+    hdma_usart2_rx.Init.Priority = DMA_PRIORITY_LOW;
+    hdma_usart2_rx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    if (HAL_DMA_Init(&hdma_usart2_rx) != HAL_OK)
+    {
+      Error_Handler();
+    }
+
+    __HAL_LINKDMA(uartHandle,hdmarx,hdma_usart2_rx);
+
+    /* USART2_TX Init */
+    hdma_usart2_tx.Instance = DMA1_Stream6;
+    hdma_usart2_tx.Init.Channel = DMA_CHANNEL_4;
+    hdma_usart2_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    hdma_usart2_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma_usart2_tx.Init.MemInc = DMA_MINC_ENABLE;
+    hdma_usart2_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hdma_usart2_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    hdma_usart2_tx.Init.Mode = DMA_NORMAL;
+    hdma_usart2_tx.Init.Priority = DMA_PRIORITY_LOW;
+    hdma_usart2_tx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    if (HAL_DMA_Init(&hdma_usart2_tx) != HAL_OK)
+    {
+      Error_Handler();
+    }
+
+    __HAL_LINKDMA(uartHandle,hdmatx,hdma_usart2_tx);
+
     /* USART2 interrupt Init */
-    HAL_NVIC_SetPriority(USART2_IRQn, 0, 0);
+    HAL_NVIC_SetPriority(USART2_IRQn, 1, 0);
     HAL_NVIC_EnableIRQ(USART2_IRQn);
   /* USER CODE BEGIN USART2_MspInit 1 */
 
@@ -96,6 +149,10 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef* uartHandle)
     */
     HAL_GPIO_DeInit(GPIOA, GPIO_PIN_2|GPIO_PIN_3);
 
+    /* USART2 DMA DeInit */
+    HAL_DMA_DeInit(uartHandle->hdmarx);
+    HAL_DMA_DeInit(uartHandle->hdmatx);
+
     /* USART2 interrupt Deinit */
     HAL_NVIC_DisableIRQ(USART2_IRQn);
   /* USER CODE BEGIN USART2_MspDeInit 1 */
@@ -106,6 +163,303 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef* uartHandle)
 
 /* USER CODE BEGIN 1 */
 
+//--------------------------------------------------------------
+// @brief Starts the DMA receive of USART2
+// @details The DMA writes every received byte into the circular buffer input.dma_buffer_rx.
+//			The CPU is only interrupted when the line goes idle and when the DMA passes
+//			the half and the end of the buffer, not for every byte.
+//--------------------------------------------------------------
+void UART_RxStart(void)
+{
+	input.dma_read_pos = 0;
+
+	hdma_usart2_rx.XferHalfCpltCallback = UART_RxDmaCallback;
+	hdma_usart2_rx.XferCpltCallback = UART_RxDmaCallback;
+	HAL_DMA_Start_IT(&hdma_usart2_rx, (uint32_t)&huart2.Instance->DR, (uint32_t)input.dma_buffer_rx, RX_DMA_BUFLEN);
+
+	__HAL_UART_CLEAR_IDLEFLAG(&huart2);
+	SET_BIT(huart2.Instance->CR3, USART_CR3_DMAR);
+	__HAL_UART_ENABLE_IT(&huart2, UART_IT_IDLE);
+}
+
+
+//--------------------------------------------------------------
+// @brief Hands the bytes the DMA received since the last call to the line assembly
+// @details Called from USART2_IRQHandler (idle line) and from the DMA half/complete
+//			callbacks, both run at the same interrupt priority.
+//--------------------------------------------------------------
+void UART_RxCheck(void)
+{
+	uint16_t pos = RX_DMA_BUFLEN - __HAL_DMA_GET_COUNTER(&hdma_usart2_rx);
+
+	if(pos == RX_DMA_BUFLEN)
+		pos = 0;
+	if(pos == input.dma_read_pos)
+		return;
+
+	if(pos > input.dma_read_pos)
+	{
+		UART_RxLine(&input.dma_buffer_rx[input.dma_read_pos], pos - input.dma_read_pos);
+	}
+	else
+	{
+		// the DMA wrapped around the end of the buffer
+		UART_RxLine(&input.dma_buffer_rx[input.dma_read_pos], RX_DMA_BUFLEN - input.dma_read_pos);
+		UART_RxLine(&input.dma_buffer_rx[0], pos);
+	}
+	input.dma_read_pos = pos;
+}
+
+
+//--------------------------------------------------------------
+// @brief Hands the received bytes to the line assembly when the line goes idle
+// @details Called from USART2_IRQHandler. The time is kept, so UART_RxLine can cut off a
+//			binary frame that pauses too long.
+//--------------------------------------------------------------
+void UART_RxIdle(void)
+{
+	UART_RxCheck();
+	input.rx_idle = 1;
+	input.idle_tick = HAL_GetTick();
+}
+
+
+static void UART_RxDmaCallback(DMA_HandleTypeDef *hdma)
+{
+	UART_RxCheck();
+}
+
+
+//--------------------------------------------------------------
+// @brief Assembles the received bytes into command lines
+// @details The line is built in the slot queue_head of rx_queue; the main loop never
+//			reads that slot. A CR or a dot ends the line, '\n' is ignored.
+//			A binSOF at the start of a line starts a binary frame instead: it ends after
+//			its length byte, the commands and the CRC, whatever bytes they are.
+//			A frame that pauses longer than RX_FRAME_GAP was cut off: it is handed over
+//			as it is (the main loop reports it damaged) and the bytes after the pause
+//			start a new line.
+//			Characters that don't fit in a slot are dropped and counted in line_overflow.
+//
+// @param[in] data The received bytes
+// @param[in] len The amount of received bytes
+//--------------------------------------------------------------
+static void UART_RxLine(const uint8_t *data, uint16_t len)
+{
+	char uart_char;
+
+	while(len--)
+	{
+		uart_char = *data++;
+
+		if(input.rx_idle)	// the first byte after the line was idle
+		{
+			input.rx_idle = 0;
+			if((input.frame_left != 0) && (HAL_GetTick() - input.idle_tick > RX_FRAME_GAP))
+			{
+				input.frame_left = 0;
+				UART_QueueLine();
+			}
+		}
+
+		if(input.frame_left != 0)	// inside a binary frame
+		{
+			input.rx_queue[input.queue_head][input.char_counter++] = uart_char;
+			if(input.char_counter == binHeaderLen)	// the length byte
+				input.frame_left = (uint8_t)uart_char + binCrcLen + 1;
+			if(--input.frame_left == 0)
+				UART_RxFrame();
+			continue;
+		}
+
+		if(((uint8_t)uart_char == binSOF) && (input.char_counter == 0))
+		{
+			input.rx_queue[input.queue_head][input.char_counter++] = uart_char;
+			input.frame_left = 1;	// the length byte
+			continue;
+		}
+
+		//Ignore the '\n' character
+		if(uart_char == LINE_FEED)
+			continue;
+
+		// Check for CR or a dot
+		// There was a small bug in the terminal program.
+		// By terminating your message with a dot you can ignore the CR (Enter) character
+		if((uart_char == CARRIAGE_RETURN) || (uart_char == '.'))
+		{
+			UART_QueueLine();
+		}
+		else if(input.char_counter < LINE_BUFLEN - 1)
+		{
+			input.rx_queue[input.queue_head][input.char_counter] = uart_char;
+			input.char_counter++;
+		}
+		else
+		{
+			input.line_overflow++;
+		}
+	}
+}
+
+
+//--------------------------------------------------------------
+// @brief Hands a complete binary frame in slot queue_head to the main loop
+// @details A frame with a wrong CRC was cut off while text lines followed it, its
+//			length byte took them in. It is cut at its first '\n': that part is handed
+//			over (the main loop reports it damaged), the bytes after the '\n' are
+//			assembled again as the lines they were. Only the line that ended at that
+//			'\n' is lost.
+//--------------------------------------------------------------
+static void UART_RxFrame(void)
+{
+	const uint8_t *frame = (const uint8_t *)input.rx_queue[input.queue_head];
+	uint16_t len = input.char_counter;
+	uint16_t lf;
+
+	if(FL_FrameValid(frame, len) == false)
+	{
+		for(lf = binHeaderLen; (lf < len) && (frame[lf] != LINE_FEED); lf++);
+		if(lf < len)
+		{
+			// the rest is read from this slot, a full queue keeps the slot and writes behind the reading
+			input.char_counter = lf;
+			UART_QueueLine();
+			UART_RxLine(&frame[lf + 1], len - lf - 1);
+			return;
+		}
+	}
+	UART_QueueLine();
+}
+
+
+//--------------------------------------------------------------
+// @brief Hands the line in slot queue_head to the main loop
+// @details The line is published by moving queue_head on, when the queue is
+//			full the line is dropped and counted in queue_overflow instead.
+//--------------------------------------------------------------
+static void UART_QueueLine(void)
+{
+	uint8_t next = (input.queue_head + 1 == CMD_QUEUE_DEPTH) ? 0 : input.queue_head + 1;
+
+	if(next == input.queue_tail)
+	{
+		input.queue_overflow++;
+	}
+	else
+	{
+		// Store the message length for processing and hand the line over
+		input.rx_queue[input.queue_head][input.char_counter] = '\0';
+		input.rx_queue_len[input.queue_head] = input.char_counter;
+		input.queue_head = next;
+	}
+	// Reset the counter for the next line
+	input.char_counter = 0;
+}
+
+
+//--------------------------------------------------------------
+// @brief Takes the oldest complete command line from the queue
+// @details Points input.line_rx_buffer and input.msglen to the line.
+//			The slot stays reserved until UART_ReleaseLine, so the line is not copied.
+//
+// @return TRUE when there is a line, FALSE when the queue is empty
+//--------------------------------------------------------------
+uint8_t UART_GetLine(void)
+{
+	if(input.queue_tail == input.queue_head)
+		return FALSE;
+
+	input.line_rx_buffer = input.rx_queue[input.queue_tail];
+	input.msglen = input.rx_queue_len[input.queue_tail];
+	return TRUE;
+}
+
+
+//--------------------------------------------------------------
+// @brief Gives the slot of the line from UART_GetLine back to the UART
+//--------------------------------------------------------------
+void UART_ReleaseLine(void)
+{
+	input.queue_tail = (input.queue_tail + 1 == CMD_QUEUE_DEPTH) ? 0 : input.queue_tail + 1;
+}
+
+
+//--------------------------------------------------------------
+// @brief Sends bytes without waiting
+// @details The bytes are copied into the transmit ring and sent by DMA in the background.
+//			Bytes that don't fit in the ring are dropped and counted in tx_dropped,
+//			so a burst of messages never stalls the main loop.
+//
+// @param[in] data The bytes to send
+// @param[in] len The amount of bytes
+//--------------------------------------------------------------
+void UART_Send(const uint8_t *data, uint16_t len)
+{
+	uint16_t head = tx_head;
+	uint16_t next;
+	uint32_t basepri;
+
+	while(len)
+	{
+		next = (head + 1 == TX_BUFLEN) ? 0 : head + 1;
+		if(next == tx_tail)
+			break;
+		tx_buffer[head] = *data++;
+		head = next;
+		len--;
+	}
+	tx_dropped += len;
+	tx_head = head;
+
+	// Start the DMA unless it is busy, its callback picks up the new bytes then.
+	// Mask the UART interrupts (priority 1) meanwhile, TIM2 (priority 0) keeps running.
+	basepri = __get_BASEPRI();
+	__set_BASEPRI(1 << (8 - __NVIC_PRIO_BITS));
+	if(tx_busy == 0)
+		UART_TxStart();
+	__set_BASEPRI(basepri);
+}
+
+
+//--------------------------------------------------------------
+// @brief Sends a string without waiting, see UART_Send
+//--------------------------------------------------------------
+void UART_Print(const char *str)
+{
+	UART_Send((const uint8_t *)str, strlen(str));
+}
+
+
+//--------------------------------------------------------------
+// @brief Starts the DMA on the oldest bytes in the transmit ring
+// @details Sends up to the end of the ring at once, the rest follows from the callback.
+//--------------------------------------------------------------
+static void UART_TxStart(void)
+{
+	uint16_t head = tx_head;
+
+	if(head == tx_tail)
+	{
+		tx_busy = 0;
+		return;
+	}
+
+	tx_busy = (head > tx_tail) ? head - tx_tail : TX_BUFLEN - tx_tail;
+	hdma_usart2_tx.XferCpltCallback = UART_TxDmaCallback;
+	HAL_DMA_Start_IT(&hdma_usart2_tx, (uint32_t)&tx_buffer[tx_tail], (uint32_t)&huart2.Instance->DR, tx_busy);
+	SET_BIT(huart2.Instance->CR3, USART_CR3_DMAT);
+}
+
+
+static void UART_TxDmaCallback(DMA_HandleTypeDef *hdma)
+{
+	uint16_t tail = tx_tail + tx_busy;
+
+	tx_tail = (tail == TX_BUFLEN) ? 0 : tail;
+	UART_TxStart();
+}
+
 /* USER CODE END 1 */
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -14,46 +14,678 @@
 //--------------------------------------------------------------
 #include "stm32_ub_vga_screen.h"
 #include "bitmap.h"
+#include <string.h>
 
 extern TIM_HandleTypeDef htim1;
 extern TIM_HandleTypeDef htim2;
+extern TIM_HandleTypeDef htim3;
 extern DMA_HandleTypeDef hdma_tim1_up;
 
 
-uint8_t VGA_RAM1[(VGA_DISPLAY_X+1)*VGA_DISPLAY_Y];
+uint8_t VGA_RAM1[VGA_RAM_BYTES] __attribute__((aligned(4)));	// word aligned for the text cells
 VGA_t VGA;
 
+// Every mode makes one byte DMA transfer per pixel: the pixel is the high byte of
+// GPIOE->ODR (PE8..PE15), a halfword or word write would drive PE0..PE7 too.
+// 4bpp and 1bpp are expanded to one byte per pixel first (VGA_LineBuf), so the
+// request rate is the pixel clock: 28MHz (168MHz / 6) in the 640 wide modes.
+// That rate is not measured on the board yet. A request the stream misses makes
+// the line short, UB_VGA_LineEnd restarts the stream then, so the next line is right.
+// Packing the memory side to words in the FIFO would quarter the RAM reads,
+// the port writes stay bytes.
+static const VGA_MODE_t VGA_Modes[VGA_MODE_COUNT] =
+{
+  // width, height, bpp, buffers, row_shift, tim1_periode
+  {320, 240, 8, 1, 1, 11},  // VGA_MODE_320x240x8, 14MHz
+  {320, 240, 4, 2, 1, 11},  // VGA_MODE_320x240x4
+  {320, 480, 4, 1, 0, 11},  // VGA_MODE_320x480x4
+  {640, 480, 1, 2, 0,  5},  // VGA_MODE_640x480x1, 28MHz
+  {160, 120, 8, 1, 2, 23},  // VGA_MODE_160x120x8, 7MHz
+  {640, 240, 0, 1, 1,  5},  // VGA_MODE_80x30, 28MHz
+  {320, 240, 0, 1, 1, 11},  // VGA_MODE_40x30
+};
+
+// Clip window of all draw functions, the whole screen by default
+static VGA_VIEWPORT_t VGA_Viewport;
+
+// Areas drawn since the last UB_VGA_ClearDirty, inclusive bounds like the viewport
+static VGA_VIEWPORT_t VGA_Dirty[VGA_DIRTY_MAX];
+static uint8_t VGA_DirtyCnt = 0;
+// 1 = UB_VGA_Swap asked for a swap, the dirty areas aren't copied back yet
+static uint8_t VGA_SwapCopy = 0;
+
+// 4bpp and 1bpp: scanout line buffers, the byte after the last pixel stays black
+static uint32_t VGA_LineBuf[2][(VGA_MAX_X / 4) + 1];
+
+// 4bpp and 1bpp: palette and the tables derived from it
+static uint8_t VGA_Palette[VGA_PAL_SIZE];
+static uint8_t VGA_PalIndex[256];		// 8-bit color -> nearest palette index
+static uint16_t VGA_PairLut[256];		// byte of two 4bpp pixels -> two 8-bit pixels
+static uint32_t VGA_MonoLut[16];		// nibble of four 1bpp pixels -> four 8-bit pixels
+static uint32_t VGA_ColorWord[VGA_PAL_SIZE];	// text modes: palette index -> four 8-bit pixels
+
+// Clip window of VGA_ClipLine: the viewport grown by the width of a line doesn't fit in VGA_VIEWPORT_t
+typedef struct {
+  int32_t x0;
+  int32_t y0;
+  int32_t x1;
+  int32_t y1;
+}VGA_CLIP_t;
+
+// Sprites: a 1bpp bitmap over the picture, the clear bits are the colour key
+typedef struct {
+  const uint8_t *src;   // first byte of the bitmap, NULL = hidden
+  int16_t x;            // top left corner, may be outside the screen
+  int16_t y;
+  uint8_t w;            // size of the bitmap
+  uint8_t h;
+  uint8_t color;        // color of the set bits
+  uint8_t z;            // higher z is drawn on top
+}VGA_SPRITE_t;
+
+static volatile VGA_SPRITE_t VGA_Sprite[VGA_SPRITE_MAX];	// set by UB_VGA_SetSprite and UB_VGA_MoveSprite
+static volatile uint8_t VGA_SpriteBusy;				// 1 while the main loop writes VGA_Sprite
+static VGA_SPRITE_t VGA_SpriteShow[VGA_SPRITE_MAX];	// shown this frame, the bottom one first
+static uint8_t VGA_SpriteCnt;						// sprites in VGA_SpriteShow
+
+static const uint8_t VGA_DefaultPalette[VGA_PAL_SIZE] =
+{
+  VGA_COL_BLACK, VGA_COL_BLUE, VGA_COL_LIGHTBLUE, VGA_COL_GREEN,
+  VGA_COL_LIGHTGREEN, VGA_COL_RED, VGA_COL_LIGHTRED, VGA_COL_WHITE,
+  VGA_COL_CYAN, VGA_COL_LIGHTCYAN, VGA_COL_MAGENTA, VGA_COL_YELLOW,
+  VGA_COL_LIGHTMAGENTA, VGA_COL_BROWN, VGA_COL_GRAY, 0x49	// 0x49 = dark gray
+};
+
+static void VGA_LoadMode(uint8_t mode);
+static void VGA_StartDMA(void);
+static uint8_t VGA_IndexByte(uint8_t color);
+static void VGA_PutIndex(uint8_t *row, int32_t xp, uint8_t value);
+static void VGA_FillBytes(uint8_t *dst, uint32_t len, uint8_t value);
+static void VGA_FillRun(int32_t xp, int32_t yp, uint16_t len, uint8_t color);
+static void VGA_FillColumn(int32_t xp, int32_t yp, uint16_t len, uint8_t color);
+static void VGA_FillRect(int32_t xp, int32_t yp, int32_t width, int32_t height, uint8_t color);
+static void VGA_ExpandRow(int32_t xp, int32_t yp, const uint8_t *src, uint16_t bytes, uint8_t shift, uint8_t color);
+static void VGA_ExpandPixels(int32_t xp, int32_t yp, const uint8_t *src, uint32_t bmX, uint16_t len, uint8_t shift, uint8_t color);
+static void VGA_BuildPaletteLuts(void);
+static void VGA_DrawSprite(uint8_t *dst, const VGA_SPRITE_t *s, uint16_t yp);
+static void VGA_MarkDirty(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+static uint8_t VGA_ClipRect(int32_t *xp, int32_t *yp, int32_t *width, int32_t *height);
+static uint8_t VGA_ClipLine(int32_t *x1, int32_t *y1, int32_t *x2, int32_t *y2, const VGA_CLIP_t *win);
+
+// Byte masks of 4 pixels for every nibble of a 1bpp bitmap row (most left pixel = lowest address)
+static const uint32_t VGA_NibbleMask[16] =
+{
+  0x00000000, 0xFF000000, 0x00FF0000, 0xFFFF0000,
+  0x0000FF00, 0xFF00FF00, 0x00FFFF00, 0xFFFFFF00,
+  0x000000FF, 0xFF0000FF, 0x00FF00FF, 0xFFFF00FF,
+  0x0000FFFF, 0xFF00FFFF, 0x00FFFFFF, 0xFFFFFFFF
+};
+
+// Byte masks of 4 pixels for every 2 bits of a 1bpp bitmap row, drawn double size
+static const uint32_t VGA_PairMask[4] =
+{
+  0x00000000, 0xFFFF0000, 0x0000FFFF, 0xFFFFFFFF
+};
+
 //--------------------------------------------------------------
 // @brief The initialisation of the VGA driver
-// @details The function initialises the timer registers of timer 1 & 2.
-//			It also initialises the DMA register.
+// @details Timer 1, 2 & 3 are set up by MX_TIM1_Init, MX_TIM2_Init and MX_TIM3_Init,
+//			this function starts them. It also initialises the DMA register: DMA2_Stream5
+//			runs in circular double buffer mode, one line per buffer (M0AR/M1AR). Timer 3
+//			opens the gate of timer 1 for one line, so the DMA needs no restart per line.
+//			TIM2_IRQHandler only sets the address of the next line, see UB_VGA_StartFrame,
+//			and the end of every line checks the stream, see UB_VGA_LineEnd.
 //--------------------------------------------------------------
 void UB_VGA_Screen_Init(void)
 {
   VGA.hsync_cnt = 0;
-  VGA.start_adr = 0;
-  VGA.dma2_cr_reg = 0;
+  VGA.start_adr = (uint32_t)&VGA_RAM1[0];
+  VGA.frame = 0;
+  VGA_LoadMode(VGA_START_MODE);
 
   GPIOB->BSRR = VGA_VSYNC_Pin;
+  GPIOE->BSRR = VGA_GPIO_HINIBBLE << 16u;  // black
+
+  // DMA2_Stream5: TIM1 update => GPIOE ODR, one line per buffer
+  // the stream starts at UB_VGA_StartFrame
+  DMA2_Stream5->CR = 0;
+  while(DMA2_Stream5->CR & DMA_SxCR_EN);
+  DMA2_Stream5->PAR = VGA_GPIOE_ODR_ADDRESS;
+  DMA2_Stream5->FCR = 0;  // direct mode
+  DMA2_Stream5->CR = DMA_CHANNEL_6 | DMA_PRIORITY_VERY_HIGH | DMA_SxCR_DBM | DMA_SxCR_CIRC |
+                     DMA_MINC_ENABLE | DMA_MEMORY_TO_PERIPH;
+
+  // TIM3: gate of one line, started by the TIM2 update.
+  // Trigger mode from UB_VGA_StartFrame on, the update loads CCR1 and the gate of the mode
+  TIM3->SMCR &= ~TIM_SMCR_SMS;
+  TIM3->ARR = VGA.gate_stop;
+  TIM3->EGR = TIM_EGR_UG;
+  TIM3->SR = 0;  // the update flag of UG
+  __HAL_TIM_ENABLE_IT(&htim3, TIM_IT_UPDATE);  // end of the gate: UB_VGA_LineEnd
+
+  // TIM1: pixel clock, counts while the gate is open (gated by TIM3, MX_TIM1_Init)
+  __HAL_TIM_ENABLE_DMA(&htim1, TIM_DMA_UPDATE);
+  __HAL_TIM_ENABLE(&htim1);
 
   // TIM2
+  TIM2->CR2 = TIM_TRGO_UPDATE;
   HAL_TIM_Base_Start(&htim2);
   HAL_TIM_PWM_Start(&htim2, TIM_CHANNEL_4);
   HAL_TIM_PWM_Start_IT(&htim2, TIM_CHANNEL_3);
+}
 
-  // TIM1
-  __HAL_TIM_ENABLE_DMA(&htim1, TIM_DMA_UPDATE);
-  __HAL_TIM_ENABLE(&htim1);
-  HAL_DMA_Start_IT(&hdma_tim1_up, (uint32_t)&VGA_RAM1[0], VGA_GPIOE_ODR_ADDRESS, VGA_DISPLAY_X + 1);
 
-  HAL_DMA_Init(&hdma_tim1_up);
-  __HAL_DMA_ENABLE_IT(&hdma_tim1_up, DMA_IT_TC);
+//--------------------------------------------------------------
+// @brief Function to select the video mode
+// @details Waits for the vertical blank and lays VGA_RAM1 out for the mode, the
+//			scanout uses it from the next frame on. The buffers are cleared to white,
+//			the viewport is the whole screen and 4bpp and 1bpp get their default palette.
+//			Everything in VGA_RAM1 is lost, also what was kept in the free part.
+//
+// @param[in] mode The video mode, VGA_MODE_...
+//
+// @return 0 when the mode doesn't exist, else 1
+//--------------------------------------------------------------
+uint8_t UB_VGA_SetMode(uint8_t mode)
+{
+  if(mode >= VGA_MODE_COUNT)
+    return 0;
+
+  UB_VGA_WaitVBlank();
+  VGA_LoadMode(mode);
+  return 1;
+}
+
+
+//--------------------------------------------------------------
+// @brief Function to read the part of VGA_RAM1 the video mode doesn't use
+// @details Free to use until the next UB_VGA_SetMode.
+//
+// @param[out] len The amount of free bytes
+//
+// @return the first free byte, word aligned
+//--------------------------------------------------------------
+uint8_t *UB_VGA_GetFreeRam(uint32_t *len)
+{
+  uint32_t used = VGA.line_bytes * ((VGA.bpp == 0) ? VGA.rows : VGA.height * VGA_Modes[VGA.mode].buffers);
+
+  used = (used + 3) & ~0x03UL;
+
+  *len = (used < VGA_RAM_BYTES) ? VGA_RAM_BYTES - used : 0;
+  return &VGA_RAM1[used];
+}
+
+
+//--------------------------------------------------------------
+// @brief Lays VGA_RAM1 out for a video mode
+// @details 8bpp: one buffer, the blanking bytes black. 4bpp and 1bpp: one or two
+//			buffers of line_bytes * height; the line buffers are cleared, the byte
+//			after the last pixel of a narrower mode has to be black.
+//			Text modes: cols * rows cells of 2 bytes, the pixel functions draw nothing.
+//			UB_VGA_StartFrame (TIM2_IRQHandler) reads the fields of the mode, so the
+//			TIM2 CC3 interrupt waits while they change; a few us, it's only late.
+//--------------------------------------------------------------
+static void VGA_LoadMode(uint8_t mode)
+{
+  const VGA_MODE_t *m = &VGA_Modes[mode];
+  uint32_t cc3 = __HAL_TIM_GET_IT_SOURCE(&htim2, TIM_IT_CC3);
+  uint8_t i;
+
+  __HAL_TIM_DISABLE_IT(&htim2, TIM_IT_CC3);
+  VGA.mode = mode;
+  VGA.width = m->width;
+  VGA.height = m->height;
+  VGA.bpp = m->bpp;
+  VGA.px_shift = (m->bpp == 1) ? 3 : 1;
+  VGA.row_shift = m->row_shift;
+  VGA.tim1_periode = m->tim1_periode;
+  VGA.gate_stop = VGA_TIM3_GATE_START + ((m->width + 1) * (m->tim1_periode + 1) / 2) - 1;
+  VGA.line_bytes = (m->bpp == 8) ? m->width + 1 : m->width >> VGA.px_shift;
+  VGA.cols = 0;
+  VGA.rows = 0;
+  if(m->bpp == 0)
+  {
+    VGA.cols = m->width / VGA_CELL_X;
+    VGA.rows = m->height / VGA_CELL_Y;
+    VGA.line_bytes = VGA.cols * 2;
+  }
+  VGA.swap = 0;
+  VGA_SwapCopy = 0;
+  VGA.draw_buf = VGA_RAM1;
+  VGA.show_buf = VGA_RAM1;
+  if(m->buffers == 2)
+    VGA.show_buf = &VGA_RAM1[VGA.line_bytes * VGA.height];
+  if(cc3 == SET)
+    __HAL_TIM_ENABLE_IT(&htim2, TIM_IT_CC3);
+
+  VGA_FillBytes(VGA_RAM1, sizeof(VGA_RAM1), VGA_COL_BLACK);
+  VGA_FillBytes((uint8_t *)VGA_LineBuf, sizeof(VGA_LineBuf), VGA_COL_BLACK);
+
+  for(i = 0; i < VGA_PAL_SIZE; i++)
+    VGA_Palette[i] = VGA_DefaultPalette[i];
+  if(m->bpp == 1)
+  {
+    VGA_Palette[0] = VGA_COL_BLACK;
+    VGA_Palette[1] = VGA_COL_WHITE;
+  }
+  VGA_BuildPaletteLuts();
+
+  UB_VGA_ResetViewport();
+  UB_VGA_FillScreen(VGA_COL_WHITE);
+  if(m->buffers == 2)
+    memcpy(VGA.show_buf, VGA.draw_buf, VGA.line_bytes * VGA.height);
+  UB_VGA_ClearDirty();
+}
+
+
+//--------------------------------------------------------------
+// @brief Function to change one palette color (4bpp and 1bpp modes)
+// @details The change is visible at once, on both buffers.
+//
+// @param[in] index The palette index, 0..15 (0..1 in 1bpp), also used by the text modes
+// @param[in] color The 8-bit color-code for this index
+//--------------------------------------------------------------
+void UB_VGA_SetPalette(uint8_t index, uint8_t color)
+{
+  if(index >= ((VGA.bpp == 1) ? 2 : VGA_PAL_SIZE))
+    return;
+
+  VGA_Palette[index] = color;
+  VGA_BuildPaletteLuts();
+}
+
+
+//--------------------------------------------------------------
+// @brief Function to start drawing (modes with two buffers)
+// @details Called by the main loop before it handles commands. Until UB_VGA_Swap the
+//			TIM2 interrupt doesn't swap the buffers, so a command is never half shown.
+//			When the buffers were swapped since UB_VGA_Swap, the dirty areas of the shown
+//			picture are copied into the draw buffer first, so the next commands draw on
+//			top of it. While the swap still waits for its frame, the commands draw into
+//			the buffer that is shown with it.
+//--------------------------------------------------------------
+void UB_VGA_StartDraw(void)
+{
+  uint8_t i;
+  uint16_t yp;
+  uint16_t x0;
+  uint16_t bytes;
+  uint32_t offset;
+
+  // first stop the swap, then look if it was done
+  VGA.drawing = 1;
+  if((VGA_SwapCopy == 0) || (VGA.swap != 0))
+    return;
+
+  // only the areas drawn since the last swap differ between the buffers
+  for(i = 0; i < VGA_DirtyCnt; i++)
+  {
+    x0 = VGA_Dirty[i].x0 >> VGA.px_shift;
+    bytes = (VGA_Dirty[i].x1 >> VGA.px_shift) - x0 + 1;
+    for(yp = VGA_Dirty[i].y0; yp <= VGA_Dirty[i].y1; yp++)
+    {
+      offset = (yp * VGA.line_bytes) + x0;
+      memcpy(&VGA.draw_buf[offset], &VGA.show_buf[offset], bytes);
+    }
+  }
+  UB_VGA_ClearDirty();
+  VGA_SwapCopy = 0;
+}
+
+
+//--------------------------------------------------------------
+// @brief Function to show the drawn buffer (modes with two buffers)
+// @details Asks the TIM2 interrupt to swap the buffers in the next vertical blank and
+//			returns, so the UART queue is handled meanwhile. The new picture starts on a
+//			new frame and never tears. The next UB_VGA_StartDraw finishes the swap.
+//			Does nothing in modes with one buffer or when nothing was drawn (e.g. while
+//			a batch is recorded).
+//--------------------------------------------------------------
+void UB_VGA_Swap(void)
+{
+  if((VGA.draw_buf != VGA.show_buf) && (VGA_DirtyCnt != 0) && (VGA_SwapCopy == 0))
+  {
+    VGA_SwapCopy = 1;
+    VGA.swap = 1;
+  }
+  VGA.drawing = 0;
+}
+
+
+//--------------------------------------------------------------
+// @brief Function to wait for the vertical blank
+// @details Returns when the TIM2 interrupt passes VGA_VSYNC_BILD_STOP, so the caller
+//			starts drawing while no line of the picture is shown (about 1.5ms).
+//--------------------------------------------------------------
+void UB_VGA_WaitVBlank(void)
+{
+  uint16_t frame = VGA.frame;
+
+  while(VGA.frame == frame)
+    VGA_WAIT_HOOK();
+}
+
+
+//--------------------------------------------------------------
+// @brief Function to read the dirty areas
+// @details Every draw function adds the area it wrote to this list, in modes with two
+//			buffers only: UB_VGA_StartDraw copies these areas. Overlapping and touching areas are merged, a full list merges the new area
+//			into the entry that grows the least, so at most VGA_DIRTY_MAX areas are kept.
+//
+// @param[out] rects Pointer to the first area, all bounds are inclusive
+//
+// @return the amount of areas
+//--------------------------------------------------------------
+uint8_t UB_VGA_GetDirty(const VGA_VIEWPORT_t **rects)
+{
+  *rects = VGA_Dirty;
+  return VGA_DirtyCnt;
+}
+
+
+//--------------------------------------------------------------
+// @brief Function to empty the list of dirty areas
+//--------------------------------------------------------------
+void UB_VGA_ClearDirty(void)
+{
+  VGA_DirtyCnt = 0;
+}
+
+
+//--------------------------------------------------------------
+// @brief Adds an area to the list of dirty areas
+// @details The area has to lie on the screen already (clipped). With one buffer
+//			nothing is copied, so nothing is kept.
+//
+// @param[in] x0,y0 The top left corner of the area
+// @param[in] x1,y1 The bottom right corner of the area (inclusive)
+//--------------------------------------------------------------
+static void VGA_MarkDirty(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+  VGA_VIEWPORT_t *d;
+  uint8_t i;
+  uint8_t best;
+  int32_t grow;
+  int32_t bestGrow;
+
+  if(VGA.draw_buf == VGA.show_buf)
+    return;
+
+  while(1)
+  {
+    // look for an entry that contains, overlaps or touches the area
+    for(i = 0; i < VGA_DirtyCnt; i++)
+    {
+      d = &VGA_Dirty[i];
+      if((x0 >= d->x0) && (x1 <= d->x1) && (y0 >= d->y0) && (y1 <= d->y1))
+        return;								//already dirty
+      if((x0 <= d->x1 + 1) && (x1 + 1 >= d->x0) && (y0 <= d->y1 + 1) && (y1 + 1 >= d->y0))
+        break;
+    }
+
+    if(i == VGA_DirtyCnt)
+    {
+      if(VGA_DirtyCnt < VGA_DIRTY_MAX)
+      {
+        d = &VGA_Dirty[VGA_DirtyCnt++];
+        d->x0 = x0;
+        d->y0 = y0;
+        d->x1 = x1;
+        d->y1 = y1;
+        return;
+      }
+
+      // list full: merge with the entry whose area grows the least
+      best = 0;
+      bestGrow = INT32_MAX;
+      for(i = 0; i < VGA_DirtyCnt; i++)
+      {
+        d = &VGA_Dirty[i];
+        grow = (((x1 > d->x1) ? x1 : d->x1) - ((x0 < d->x0) ? x0 : d->x0) + 1) *
+               (((y1 > d->y1) ? y1 : d->y1) - ((y0 < d->y0) ? y0 : d->y0) + 1) -
+               ((d->x1 - d->x0 + 1) * (d->y1 - d->y0 + 1));
+        if(grow < bestGrow)
+        {
+          bestGrow = grow;
+          best = i;
+        }
+      }
+      i = best;
+    }
+
+    // take the entry out of the list and go on with the union,
+    // it can reach other entries now
+    d = &VGA_Dirty[i];
+    if(d->x0 < x0) x0 = d->x0;
+    if(d->y0 < y0) y0 = d->y0;
+    if(d->x1 > x1) x1 = d->x1;
+    if(d->y1 > y1) y1 = d->y1;
+    *d = VGA_Dirty[--VGA_DirtyCnt];
+  }
+}
+
+
+//--------------------------------------------------------------
+// @brief Restarts the scanout at the first line (called from TIM2_IRQHandler)
+// @details Called on the last line before VGA_VSYNC_BILD_START. The gate is closed
+//			during the vertical blank, so the stream is idle and can be reloaded:
+//			both address registers get the first row, CT = 0. The pixel clock,
+//			the gate and the line length of the video mode are loaded here too,
+//			and the sprites for the whole frame.
+//			Every line after it only sets VGA.start_adr in the address register
+//			the DMA doesn't read.
+//--------------------------------------------------------------
+void UB_VGA_StartFrame(void)
+{
+  UB_VGA_LatchSprites();
+  VGA.start_adr = UB_VGA_ScanLine(0);
+
+  // the count of the old mode can be above the new ARR, TIM1 would run on to 0xFFFF then.
+  // CNT is written instead of an update event (UG), that would make a DMA request
+  TIM1->ARR = VGA.tim1_periode;
+  TIM1->CNT = 0;
+  TIM3->ARR = VGA.gate_stop;
+
+  VGA_StartDMA();
+
+  // the gate opens from the next TIM2 update on
+  TIM3->SMCR |= TIM_SLAVEMODE_TRIGGER;
+}
+
+
+//--------------------------------------------------------------
+// @brief Checks the stream at the end of every line (called from TIM3_IRQHandler)
+// @details A line that got exactly width + 1 DMA requests leaves NDTR reloaded
+//			to width + 1 and CT on the buffer of the next line. Any other count
+//			(a TIM1 update too many or too few) would shift every following
+//			line, so the stream is restarted at the next line: the gate is closed,
+//			VGA.start_adr is already the next line (TIM2_IRQHandler).
+//--------------------------------------------------------------
+void UB_VGA_LineEnd(void)
+{
+  if(DMA2_Stream5->NDTR == VGA.width + 1)
+    return;
+
+  TIM1->CNT = 0;
+  VGA_StartDMA();
+}
+
 
-  //-----------------------
-  // Register swap and safe
-  //-----------------------
-  // content of CR-Register read and save
-  VGA.dma2_cr_reg = DMA2_Stream5->CR;
+//--------------------------------------------------------------
+// @brief Restarts DMA2_Stream5 at VGA.start_adr
+// @details Only while the gate is closed: both address registers get the
+//			same line, CT = 0 and a full line in NDTR.
+//--------------------------------------------------------------
+static void VGA_StartDMA(void)
+{
+  DMA2_Stream5->CR &= ~(DMA_SxCR_EN | DMA_SxCR_CT);
+  while(DMA2_Stream5->CR & DMA_SxCR_EN);
+  DMA2->HIFCR = DMA_HIFCR_CTCIF5 | DMA_HIFCR_CHTIF5 | DMA_HIFCR_CTEIF5 | DMA_HIFCR_CDMEIF5 | DMA_HIFCR_CFEIF5;
+  DMA2_Stream5->NDTR = VGA.width + 1;
+  DMA2_Stream5->M0AR = VGA.start_adr;
+  DMA2_Stream5->M1AR = VGA.start_adr;
+  DMA2_Stream5->CR |= DMA_SxCR_EN;
+}
+
+
+//--------------------------------------------------------------
+// @brief Gives the line the DMA shows for a row (called from TIM2_IRQHandler)
+// @details 8bpp: the row in the shown buffer itself, or a copy of it in line buffer
+//			yp & 1 when a sprite is on the row. Other modes: the expanded row.
+//			The sprites are drawn over the line, the bottom one first.
+//
+// @param[in] yp The row of the shown buffer
+//
+// @return the address of the line, for DMA2_Stream5->M0AR/M1AR
+//--------------------------------------------------------------
+uint32_t UB_VGA_ScanLine(uint16_t yp)
+{
+  uint8_t *dst;
+  uint8_t i;
+
+  for(i = 0; i < VGA_SpriteCnt; i++)
+  {
+    if((uint16_t)(yp - VGA_SpriteShow[i].y) < VGA_SpriteShow[i].h)
+      break;
+  }
+
+  if(VGA.bpp != 8)
+    dst = (uint8_t *)UB_VGA_ExpandLine(yp);
+  else if(i == VGA_SpriteCnt)
+    return (uint32_t)&VGA.show_buf[yp * VGA.line_bytes];
+  else
+  {
+    dst = (uint8_t *)VGA_LineBuf[yp & 0x01];
+    memcpy(dst, &VGA.show_buf[yp * VGA.line_bytes], VGA.width);
+  }
+
+  for(; i < VGA_SpriteCnt; i++)
+    VGA_DrawSprite(dst, &VGA_SpriteShow[i], yp);
+
+  return (uint32_t)dst;
+}
+
+
+//--------------------------------------------------------------
+// @brief Draws one row of a sprite into a line, if the sprite is on the row
+//--------------------------------------------------------------
+static void VGA_DrawSprite(uint8_t *dst, const VGA_SPRITE_t *s, uint16_t yp)
+{
+  const uint8_t *src;
+  int32_t px;
+  int32_t end;
+
+  px = (uint16_t)(yp - s->y);
+  if(px >= s->h)
+    return;
+  src = s->src + (px * BM_ROW_BYTES(s->w));
+
+  // the columns of the sprite on the screen
+  px = (s->x < 0) ? -s->x : 0;
+  end = (s->x + s->w > VGA.width) ? VGA.width - s->x : s->w;
+  for(; px < end; px++)
+  {
+    if(src[px >> 3] & (0x80 >> (px & 0x07)))
+      dst[s->x + px] = s->color;
+  }
+}
+
+
+//--------------------------------------------------------------
+// @brief Expands one 4bpp, 1bpp or text line for the scanout (called from TIM2_IRQHandler)
+// @details Turns row yp of the shown buffer into 8-bit pixels in line buffer yp & 1,
+//			one word (4 pixels) at a time. The DMA reads the other line buffer meanwhile.
+//			Text modes: row yp % VGA_CELL_Y of the glyph of every cell, in the colors
+//			of its attribute.
+//
+// @param[in] yp The row of the shown buffer
+//
+// @return the address of the line buffer, for DMA2_Stream5->M0AR/M1AR
+//--------------------------------------------------------------
+uint32_t UB_VGA_ExpandLine(uint16_t yp)
+{
+  const uint8_t *src = &VGA.show_buf[yp * VGA.line_bytes];
+  const uint16_t *cell;
+  uint32_t *dst = VGA_LineBuf[yp & 0x01];
+  uint32_t fg;
+  uint32_t bg;
+  uint8_t bits;
+  uint16_t n;
+
+  if(VGA.bpp == 0)
+  {
+    cell = (const uint16_t *)VGA.show_buf + ((yp / VGA_CELL_Y) * VGA.cols);
+    yp %= VGA_CELL_Y;
+    for(n = 0; n < VGA.cols; n++)
+    {
+      bits = font_8x8[cell[n] & 0x7F][yp];
+      fg = VGA_ColorWord[(cell[n] >> 8) & 0x0F];
+      bg = VGA_ColorWord[cell[n] >> 12];
+      dst[2 * n] = bg ^ ((fg ^ bg) & VGA_NibbleMask[bits >> 4]);
+      dst[(2 * n) + 1] = bg ^ ((fg ^ bg) & VGA_NibbleMask[bits & 0x0F]);
+    }
+  }
+  else if(VGA.bpp == 1)
+  {
+    for(n = 0; n < VGA.line_bytes; n++)
+    {
+      dst[2 * n] = VGA_MonoLut[src[n] & 0x0F];
+      dst[(2 * n) + 1] = VGA_MonoLut[src[n] >> 4];
+    }
+  }
+  else
+  {
+    for(n = 0; n < VGA.line_bytes; n += 4)
+    {
+      dst[n >> 1] = VGA_PairLut[src[n]] | ((uint32_t)VGA_PairLut[src[n + 1]] << 16);
+      dst[(n >> 1) + 1] = VGA_PairLut[src[n + 2]] | ((uint32_t)VGA_PairLut[src[n + 3]] << 16);
+    }
+  }
+
+  return (uint32_t)dst;
+}
+
+
+//--------------------------------------------------------------
+// @brief Rebuilds the tables that depend on the palette
+// @details VGA_PairLut, VGA_MonoLut and VGA_ColorWord for the scanout (the most left
+//			pixel = first byte) and VGA_PalIndex, the nearest entry of every 8-bit color
+//			in the palette of the mode (2 colors in 1bpp, else 16).
+//--------------------------------------------------------------
+static void VGA_BuildPaletteLuts(void)
+{
+  uint16_t c;
+  uint8_t i;
+  int16_t dr;
+  int16_t dg;
+  int16_t db;
+  uint16_t dist;
+  uint16_t best;
+
+  for(c = 0; c < 256; c++)
+    VGA_PairLut[c] = VGA_Palette[c & 0x0F] | (VGA_Palette[c >> 4] << 8);
+  for(c = 0; c < 16; c++)
+    VGA_MonoLut[c] = VGA_Palette[c & 0x01] | (VGA_Palette[(c >> 1) & 0x01] << 8) |
+                     (VGA_Palette[(c >> 2) & 0x01] << 16) | ((uint32_t)VGA_Palette[c >> 3] << 24);
+  for(c = 0; c < VGA_PAL_SIZE; c++)
+    VGA_ColorWord[c] = VGA_Palette[c] * 0x01010101UL;
+
+  for(c = 0; c < 256; c++)
+  {
+    best = 0xFFFF;
+    for(i = 0; i < ((VGA.bpp == 1) ? 2 : VGA_PAL_SIZE); i++)
+    {
+      dr = (int16_t)(c >> 5) - (VGA_Palette[i] >> 5);
+      dg = (int16_t)((c >> 2) & 0x07) - ((VGA_Palette[i] >> 2) & 0x07);
+      db = (int16_t)((c & 0x03) << 1) - ((VGA_Palette[i] & 0x03) << 1);
+      dist = (dr * dr) + (dg * dg) + (db * db);
+      if(dist < best)
+      {
+        best = dist;
+        VGA_PalIndex[c] = i;
+      }
+    }
+  }
 }
 
 
@@ -65,12 +697,28 @@ void UB_VGA_Screen_Init(void)
 //--------------------------------------------------------------
 void UB_VGA_FillScreen(uint8_t color)
 {
-  uint16_t xp,yp;
+  uint16_t yp;
+  uint8_t *row = VGA.draw_buf;
 
-  for(yp = 0; yp < VGA_DISPLAY_Y; yp++) {
-    for(xp = 0; xp < VGA_DISPLAY_X; xp++) {
-      UB_VGA_SetPixel(xp, yp, color);
-    }
+  // text modes: empty cells, color is the background
+  if(VGA.bpp == 0)
+  {
+    UB_VGA_ScrollText(VGA.rows, UB_VGA_TextAttr(VGA_COL_BLACK, color));
+    return;
+  }
+
+  VGA_MarkDirty(0, 0, VGA.width - 1, VGA.height - 1);
+
+  if(VGA.bpp != 8)
+  {
+    VGA_FillBytes(VGA.draw_buf, VGA.line_bytes * VGA.height, VGA_IndexByte(color));
+    return;
+  }
+
+  // Fill line by line, the blanking byte at the end of each line stays black
+  for(yp = 0; yp < VGA.height; yp++) {
+    VGA_FillBytes(row, VGA.width, color);
+    row += VGA.line_bytes;
   }
 }
 
@@ -78,6 +726,7 @@ void UB_VGA_FillScreen(uint8_t color)
 //--------------------------------------------------------------
 // @brief Function to color a single pixel
 // @details This function writes a single color of a single pixel to the ram.
+//			Pixels outside the viewport are not drawn.
 //
 // @param[in] xp The X-coordinate of the pixel
 // @param[in] yp The Y-coordinate of the pixel
@@ -85,13 +734,302 @@ void UB_VGA_FillScreen(uint8_t color)
 //--------------------------------------------------------------
 void UB_VGA_SetPixel(uint16_t xp, uint16_t yp, uint8_t color)
 {
-  if(xp >= VGA_DISPLAY_X)
-    xp = 0;
-  if(yp >= VGA_DISPLAY_Y)
-    yp = 0;
+  if((xp < VGA_Viewport.x0) || (xp > VGA_Viewport.x1) ||
+     (yp < VGA_Viewport.y0) || (yp > VGA_Viewport.y1))
+    return;
 
   // Write pixel to ram
-  VGA_RAM1[(yp * (VGA_DISPLAY_X + 1)) + xp] = color;
+  VGA_MarkDirty(xp, yp, xp, yp);
+  VGA_FillRun(xp, yp, 1, color);
+}
+
+
+//--------------------------------------------------------------
+// @brief Function to draw a horizontal run of pixels
+// @details This function writes a single color to len pixels on line yp,
+//			starting at xp. The run is clipped once against the viewport, not per pixel.
+//
+// @param[in] xp The X-coordinate of the first pixel of the run
+// @param[in] yp The Y-coordinate of the run
+// @param[in] len The amount of pixels in the run
+// @param[in] color The 8-bit color-code to display
+//--------------------------------------------------------------
+void UB_VGA_FillSpan(uint16_t xp, uint16_t yp, uint16_t len, uint8_t color)
+{
+  int32_t x = xp;
+  int32_t y = yp;
+  int32_t w = len;
+  int32_t h = 1;
+
+  if(!VGA_ClipRect(&x, &y, &w, &h))
+    return;
+
+  VGA_MarkDirty(x, y, x + w - 1, y);
+  VGA_FillRun(x, y, w, color);
+}
+
+
+//--------------------------------------------------------------
+// @brief Function to set the viewport
+// @details All draw functions (except FillScreen and clearScreen) are clipped against
+//			this window. It is clamped to the screen; a window outside the screen
+//			leaves nothing drawable until UB_VGA_ResetViewport is called.
+//			In the text modes the window is always empty.
+//
+// @param[in] xp The X-coordinate of the top left corner of the viewport
+// @param[in] yp The Y-coordinate of the top left corner of the viewport
+// @param[in] width The width of the viewport in pixels
+// @param[in] height The height of the viewport in pixels
+//--------------------------------------------------------------
+void UB_VGA_SetViewport(uint16_t xp, uint16_t yp, uint16_t width, uint16_t height)
+{
+  int32_t x1 = (int32_t)xp + width - 1;
+  int32_t y1 = (int32_t)yp + height - 1;
+
+  if(VGA.bpp == 0)
+    return;
+  if(x1 >= VGA.width)
+    x1 = VGA.width - 1;
+  if(y1 >= VGA.height)
+    y1 = VGA.height - 1;
+
+  // an empty window has x0 > x1 or y0 > y1
+  VGA_Viewport.x0 = (xp < VGA.width) ? xp : VGA.width;
+  VGA_Viewport.y0 = (yp < VGA.height) ? yp : VGA.height;
+  VGA_Viewport.x1 = x1;
+  VGA_Viewport.y1 = y1;
+}
+
+
+//--------------------------------------------------------------
+// @brief Function to reset the viewport to the whole screen
+// @details Text modes: an empty window, the cells are no pixels.
+//--------------------------------------------------------------
+void UB_VGA_ResetViewport(void)
+{
+  VGA_Viewport.x0 = 0;
+  VGA_Viewport.y0 = 0;
+  VGA_Viewport.x1 = VGA.width - 1;
+  VGA_Viewport.y1 = VGA.height - 1;
+  if(VGA.bpp == 0)
+    VGA_Viewport.x1 = -1;
+}
+
+
+//--------------------------------------------------------------
+// @brief Clips a rectangle against the viewport
+// @details Moves and shrinks the rectangle so it lies completely inside the viewport.
+//
+// @return 0 when nothing of the rectangle is visible, else 1
+//--------------------------------------------------------------
+static uint8_t VGA_ClipRect(int32_t *xp, int32_t *yp, int32_t *width, int32_t *height)
+{
+  if(*xp < VGA_Viewport.x0)
+  {
+    *width -= VGA_Viewport.x0 - *xp;
+    *xp = VGA_Viewport.x0;
+  }
+  if(*yp < VGA_Viewport.y0)
+  {
+    *height -= VGA_Viewport.y0 - *yp;
+    *yp = VGA_Viewport.y0;
+  }
+  if(*width > (VGA_Viewport.x1 - *xp + 1))
+    *width = VGA_Viewport.x1 - *xp + 1;
+  if(*height > (VGA_Viewport.y1 - *yp + 1))
+    *height = VGA_Viewport.y1 - *yp + 1;
+
+  return (*width > 0) && (*height > 0);
+}
+
+
+//--------------------------------------------------------------
+// @brief Clips a line against a window (Cohen-Sutherland)
+// @details Moves both end points of the line onto or inside the window.
+//			The intersections are computed in 64 bits, the product of two
+//			coordinate differences doesn't fit in 32 bits for the whole uint16_t range.
+//
+// @return 0 when nothing of the line is inside the window, else 1
+//--------------------------------------------------------------
+#define VGA_CLIP_LEFT    0x01
+#define VGA_CLIP_RIGHT   0x02
+#define VGA_CLIP_TOP     0x04
+#define VGA_CLIP_BOTTOM  0x08
+
+static uint8_t VGA_ClipCode(int32_t x, int32_t y, const VGA_CLIP_t *win)
+{
+  uint8_t code = 0;
+
+  if(x < win->x0)
+    code |= VGA_CLIP_LEFT;
+  else if(x > win->x1)
+    code |= VGA_CLIP_RIGHT;
+  if(y < win->y0)
+    code |= VGA_CLIP_TOP;
+  else if(y > win->y1)
+    code |= VGA_CLIP_BOTTOM;
+
+  return code;
+}
+
+static uint8_t VGA_ClipLine(int32_t *x1, int32_t *y1, int32_t *x2, int32_t *y2, const VGA_CLIP_t *win)
+{
+  uint8_t code1 = VGA_ClipCode(*x1, *y1, win);
+  uint8_t code2 = VGA_ClipCode(*x2, *y2, win);
+  uint8_t code;
+  int32_t x;
+  int32_t y;
+
+  while(code1 | code2)
+  {
+    if(code1 & code2)
+      return 0;								//both points on the same outer side
+
+    code = code1 ? code1 : code2;
+    if(code & VGA_CLIP_TOP)
+    {
+      x = *x1 + (int64_t)(*x2 - *x1) * (win->y0 - *y1) / (*y2 - *y1);
+      y = win->y0;
+    }
+    else if(code & VGA_CLIP_BOTTOM)
+    {
+      x = *x1 + (int64_t)(*x2 - *x1) * (win->y1 - *y1) / (*y2 - *y1);
+      y = win->y1;
+    }
+    else if(code & VGA_CLIP_LEFT)
+    {
+      y = *y1 + (int64_t)(*y2 - *y1) * (win->x0 - *x1) / (*x2 - *x1);
+      x = win->x0;
+    }
+    else
+    {
+      y = *y1 + (int64_t)(*y2 - *y1) * (win->x1 - *x1) / (*x2 - *x1);
+      x = win->x1;
+    }
+
+    if(code == code1)
+    {
+      *x1 = x;
+      *y1 = y;
+      code1 = VGA_ClipCode(x, y, win);
+    }
+    else
+    {
+      *x2 = x;
+      *y2 = y;
+      code2 = VGA_ClipCode(x, y, win);
+    }
+  }
+
+  return 1;
+}
+
+
+//--------------------------------------------------------------
+// @brief Span fill engine
+// @details Writes len pixels of one color on line yp, starting at xp.
+//			In 4bpp and 1bpp modes the first and last pixels can share a byte with a
+//			neighbour, the bytes in between are filled whole.
+//			No clipping is done here, the caller has to stay inside one line.
+//
+// @param[in] xp The X-coordinate of the first pixel
+// @param[in] yp The Y-coordinate of the line
+// @param[in] len The amount of pixels to write
+// @param[in] color The 8-bit color-code to display
+//--------------------------------------------------------------
+static void VGA_FillRun(int32_t xp, int32_t yp, uint16_t len, uint8_t color)
+{
+  uint8_t *row;
+  uint8_t value;
+  uint8_t last = (1 << VGA.px_shift) - 1;	// the last pixel in a byte
+
+  if(VGA.bpp == 8)
+  {
+    VGA_FillBytes(&VGA.draw_buf[(yp * VGA.line_bytes) + xp], len, color);
+    return;
+  }
+
+  row = &VGA.draw_buf[yp * VGA.line_bytes];
+  value = VGA_IndexByte(color);
+  while((xp & last) && len)
+  {
+    VGA_PutIndex(row, xp++, value);
+    len--;
+  }
+  VGA_FillBytes(&row[xp >> VGA.px_shift], len >> VGA.px_shift, value);
+  xp += len & ~last;
+  len &= last;
+  while(len--)
+    VGA_PutIndex(row, xp++, value);
+}
+
+
+//--------------------------------------------------------------
+// @brief The byte of a 4bpp or 1bpp color, every pixel in it the nearest palette index
+//--------------------------------------------------------------
+static uint8_t VGA_IndexByte(uint8_t color)
+{
+  return VGA_PalIndex[color] * ((VGA.bpp == 1) ? 0xFF : 0x11);
+}
+
+
+//--------------------------------------------------------------
+// @brief Writes one 4bpp or 1bpp pixel
+// @details The most left pixel is in the lowest bits of a byte.
+//
+// @param[in] row Pointer to the first byte of the line
+// @param[in] xp The X-coordinate of the pixel
+// @param[in] value A byte of the color, see VGA_IndexByte
+//--------------------------------------------------------------
+static void VGA_PutIndex(uint8_t *row, int32_t xp, uint8_t value)
+{
+  uint8_t mask = ((1 << VGA.bpp) - 1) << ((xp & ((1 << VGA.px_shift) - 1)) * VGA.bpp);
+
+  row += xp >> VGA.px_shift;
+  *row = (*row & ~mask) | (value & mask);
+}
+
+
+//--------------------------------------------------------------
+// @brief Byte fill engine
+// @details Writes len bytes of one value to the ram. Bytes are written until dst is
+//			word aligned, then 4 words (16 bytes) per loop, then the remaining bytes.
+//
+// @param[in] dst Pointer to the first byte
+// @param[in] len The amount of bytes to write
+// @param[in] value The value of every byte
+//--------------------------------------------------------------
+static void VGA_FillBytes(uint8_t *dst, uint32_t len, uint8_t value)
+{
+  uint32_t pattern;
+  uint32_t *dst32;
+
+  // head: single bytes up to the first word boundary
+  while(len && ((uintptr_t)dst & 0x03)) {
+    *dst++ = value;
+    len--;
+  }
+
+  // body: the value repeated in all 4 bytes of a word
+  pattern = value * 0x01010101UL;
+  dst32 = (uint32_t *)dst;
+  while(len >= 16) {
+    dst32[0] = pattern;
+    dst32[1] = pattern;
+    dst32[2] = pattern;
+    dst32[3] = pattern;
+    dst32 += 4;
+    len -= 16;
+  }
+  while(len >= 4) {
+    *dst32++ = pattern;
+    len -= 4;
+  }
+
+  // tail: the remaining bytes
+  dst = (uint8_t *)dst32;
+  while(len--)
+    *dst++ = value;
 }
 
 
@@ -99,6 +1037,9 @@ void UB_VGA_SetPixel(uint16_t xp, uint16_t yp, uint8_t color)
 // @brief Function to draw a line.
 // @details This function draws a single color to a line with a customisable width from a
 //			custom coordinate (point 1) to another custom coordinate (point 2).
+//			The line is walked with the integer Bresenham algorithm, so all octants work.
+//			For every step a short span perpendicular to the main direction is written:
+//			a vertical span for mostly horizontal lines and a horizontal span otherwise.
 //
 // @param[in] x1 The X-coordinate of point 1 of the line
 // @param[in] y1 The Y-coordinate of point 1 of the line
@@ -109,69 +1050,141 @@ void UB_VGA_SetPixel(uint16_t xp, uint16_t yp, uint8_t color)
 //--------------------------------------------------------------
 void UB_VGA_SetLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t color, uint16_t width)
 {
-  int16_t dx;
-  int16_t dy;
-  uint16_t px;
-  uint16_t py;
-  uint16_t dxabs;
-  uint16_t dyabs;
-  uint16_t i; 								//Count the x or y pixels
-  uint16_t j; 								//Count amount of width pixels
-  uint8_t neg;
-  uint16_t amPerSide;
-  float slope;
-
-  dx=x2-x1;      							//the horizontal distance of the line
-  dy=y2-y1;      							//the vertical distance of the line
-  dxabs=abs(dx);
-  dyabs=abs(dy);
-  amPerSide = width / 2;
-  neg = width % 2;
-
-  if (dxabs>=dyabs) 						//the line is more horizontal than vertical
-  {
-    slope=(float)dy / (float)dx;
-    for(i=0;i!=dx;i++)
-    {
-      px=i+x1;
-      py=slope*i+y1;						//Calculate Y-value for the current Y-value
-      UB_VGA_SetPixel(px,py,color);
+  int32_t x = x1;
+  int32_t y = y1;
+  int32_t xe = x2;
+  int32_t ye = y2;
+  int32_t dx;								//the horizontal distance of the line
+  int32_t dy;								//the negative vertical distance of the line
+  int32_t sx;								//step direction in x
+  int32_t sy;								//step direction in y
+  int32_t err;
+  int32_t e2;
+  int32_t thick;							//amount of pixels per perpendicular span
+  int32_t before;							//width pixels on the negative side of the line
+  int32_t after;							//width pixels on the positive side of the line
+  int32_t s0;								//clipped start of a perpendicular span
+  int32_t s1;								//clipped end of a perpendicular span
+  int32_t bx;								//the damaged area of the line
+  int32_t by;
+  int32_t bw;
+  int32_t bh;
+  uint8_t xMajor;
+  VGA_CLIP_t win;
 
-      for(j = 0; j <= amPerSide; j++)
-      {
-          py = slope * i + y1 + j;			//Calculate extra width-pixels on the positive side
-          UB_VGA_SetPixel(px,py,color);
+  thick = (width > 0) ? width : 1;
+  before = (thick - 1) / 2;
+  after = thick - 1 - before;
+  xMajor = (abs(xe - x) >= abs(ye - y));
 
-          if(!(neg) && (j == amPerSide))
-        	  break;						//Break when positive and last width pixel
+  // Clip once: the main axis against the viewport, the perpendicular
+  // axis against the viewport grown by the width of the line
+  win.x0 = VGA_Viewport.x0;
+  win.y0 = VGA_Viewport.y0;
+  win.x1 = VGA_Viewport.x1;
+  win.y1 = VGA_Viewport.y1;
+  if(xMajor)
+  {
+    win.y0 -= after;
+    win.y1 += before;
+  }
+  else
+  {
+    win.x0 -= after;
+    win.x1 += before;
+  }
+  if(!VGA_ClipLine(&x, &y, &xe, &ye, &win))
+    return;
 
-          py = slope * i + y1 - j;			//Calculate extra width-pixels on the negative side
-          UB_VGA_SetPixel(px,py,color);
-      }
-    }
+  // the damaged area: the bounding box of the clipped line grown by its width
+  bx = (x < xe) ? x : xe;
+  by = (y < ye) ? y : ye;
+  bw = abs(xe - x) + 1;
+  bh = abs(ye - y) + 1;
+  if(xMajor)
+  {
+    by -= before;
+    bh += thick - 1;
   }
-  else 										//the line is more vertical than horizontal
+  else
   {
-    slope=(float)dx / (float)dy;
-    for(i=0;i!=dy;i++)
+    bx -= before;
+    bw += thick - 1;
+  }
+  if(!VGA_ClipRect(&bx, &by, &bw, &bh))
+    return;
+  VGA_MarkDirty(bx, by, bx + bw - 1, by + bh - 1);
+
+  dx = abs(xe - x);
+  dy = -abs(ye - y);
+  sx = (x < xe) ? 1 : -1;
+  sy = (y < ye) ? 1 : -1;
+  err = dx + dy;
+
+  while(1)
+  {
+    if(xMajor)								//the line is more horizontal than vertical
     {
-      px=slope*i+x1; 						//Calculate X-value for the current Y-value
-      py=i+y1;
+      s0 = (y - before < VGA_Viewport.y0) ? VGA_Viewport.y0 : y - before;
+      s1 = (y + after > VGA_Viewport.y1) ? VGA_Viewport.y1 : y + after;
+      if(s1 >= s0)
+        VGA_FillColumn(x, s0, s1 - s0 + 1, color);
+    }
+    else									//the line is more vertical than horizontal
+    {
+      s0 = (x - before < VGA_Viewport.x0) ? VGA_Viewport.x0 : x - before;
+      s1 = (x + after > VGA_Viewport.x1) ? VGA_Viewport.x1 : x + after;
+      if(s1 >= s0)
+        VGA_FillRun(s0, y, s1 - s0 + 1, color);
+    }
 
-      UB_VGA_SetPixel(px,py,color);
+    if((x == xe) && (y == ye))
+      break;
 
-      for(j = 0; j <= amPerSide; j++)
-      {
-          px = slope * i + x1 + j;			//Calculate extra width-pixels on the positive side
-    	  UB_VGA_SetPixel(px,py,color);
+    e2 = 2 * err;
+    if(e2 >= dy)
+    {
+      err += dy;
+      x += sx;
+    }
+    if(e2 <= dx)
+    {
+      err += dx;
+      y += sy;
+    }
+  }
+}
 
-    	  if(!(neg) && (j == amPerSide))
-    		  break;						//Break when positive and last width pixel
 
-          px = slope * i + x1 - j;			//Calculate extra width-pixels on the negative side
-    	  UB_VGA_SetPixel(px,py,color);
-      }
+//--------------------------------------------------------------
+// @brief Function to draw a vertical run of pixels
+// @details Writes len pixels of one color downwards from (xp,yp), one line stride per pixel.
+//			No clipping is done here.
+//--------------------------------------------------------------
+static void VGA_FillColumn(int32_t xp, int32_t yp, uint16_t len, uint8_t color)
+{
+  uint8_t *dst;
+  uint8_t mask;
+  uint8_t bits;
+
+  if(VGA.bpp == 8)
+  {
+    dst = &VGA.draw_buf[(yp * VGA.line_bytes) + xp];
+    while(len--)
+    {
+      *dst = color;
+      dst += VGA.line_bytes;
     }
+    return;
+  }
+
+  dst = &VGA.draw_buf[(yp * VGA.line_bytes) + (xp >> VGA.px_shift)];
+  mask = ~(((1 << VGA.bpp) - 1) << ((xp & ((1 << VGA.px_shift) - 1)) * VGA.bpp));	// the neighbours
+  bits = VGA_IndexByte(color) & ~mask;
+  while(len--)
+  {
+    *dst = (*dst & mask) | bits;
+    dst += VGA.line_bytes;
   }
 }
 
@@ -179,6 +1192,7 @@ void UB_VGA_SetLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t
 // @brief Function to draw a rectangle.
 // @details This function draws a rectangle starting with the coördinates of the top left
 //			corner of the rectangle. It also has the potential to fill the rectangle with a color.
+//			The border and the filling are written as horizontal spans, every pixel once.
 //
 // @param[in] xp: The X-coordinate of the top left corner of the rectangle
 // @param[in] yp: The Y-coordinate of the top left corner of the rectangle
@@ -190,68 +1204,52 @@ void UB_VGA_SetLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t
 // @param[in] lineWidth: The width of the line that determines the border of the rectangle
 //--------------------------------------------------------------
 
-void UB_VGA_DrawRectangle(uint16_t xp, uint16_t yp, uint8_t width, uint8_t height, uint8_t color, uint8_t filled,
+void UB_VGA_DrawRectangle(uint16_t xp, uint16_t yp, uint16_t width, uint16_t height, uint8_t color, uint8_t filled,
 		uint8_t bordercolor, uint8_t lineWidth)
 {
-	uint16_t px;
-	uint16_t py;
-	uint16_t i;
-	uint16_t j;
-
-	if(xp >= VGA_DISPLAY_X)
-	  xp = 0;
-	if(yp >= VGA_DISPLAY_Y)
-	  yp = 0;
+	int32_t w = (int32_t)width + 1;		//the rectangle runs from xp up to and including xp + width
+	int32_t h = (int32_t)height + 1;	//the rectangle runs from yp up to and including yp + height
+	int32_t lw = lineWidth;
+	int32_t innerW;
+	int32_t innerH;
 
-	/* the vertical part of the rectangle */
-	for(j=0; j < lineWidth; j++)
+	/* a border wider than half the rectangle covers all of it */
+	if((2 * lw >= w) || (2 * lw >= h))
 	{
-		for(i=0; i <= height; i++)
-		{
-			py = yp + i;
-			px = xp + j;
-			UB_VGA_SetPixel(px,py,bordercolor);
-		}
-		for(i=0; i <= height; i++)
-		{
-			py = yp + i;
-			px = xp + width - j;
-			UB_VGA_SetPixel(px,py,bordercolor);
-		}
+		VGA_FillRect(xp, yp, w, h, bordercolor);
+		return;
 	}
 
-    /* the horizontal part of the rectangle */
-	for(j=0; j < lineWidth; j++)
-	{
-		for(i=0; i <= width-lineWidth; i++)
-		{
-			py = yp + j;
-			px = xp + i + lineWidth;
-			UB_VGA_SetPixel(px,py,bordercolor);
-		}
-		for(i=0; i <= width-lineWidth; i++)
-		{
-			py = yp + height - j;
-			px = xp + i + lineWidth;
-			UB_VGA_SetPixel(px,py,bordercolor);
-		}
-	}
+	innerW = w - (2 * lw);
+	innerH = h - (2 * lw);
 
-    /* filling in the rectangle */
-    if(filled == 1)
-    {
-    	for(i=0; i <= width-lineWidth*2; i++)
-    	{
-    		px = xp + i + lineWidth;
-
-        	for(j=0; j <= height-(lineWidth*2); j++)
-        	{
-        		py = yp + j + lineWidth;
-        		UB_VGA_SetPixel(px,py,color);
-        	}
-    	}
-    }
+	/* the horizontal part of the rectangle, full width */
+	VGA_FillRect(xp, yp, w, lw, bordercolor);
+	VGA_FillRect(xp, yp + h - lw, w, lw, bordercolor);
 
+	/* the vertical part of the rectangle, between the horizontal parts */
+	VGA_FillRect(xp, yp + lw, lw, innerH, bordercolor);
+	VGA_FillRect(xp + w - lw, yp + lw, lw, innerH, bordercolor);
+
+	/* filling in the rectangle */
+	if(filled == 1)
+		VGA_FillRect(xp + lw, yp + lw, innerW, innerH, color);
+}
+
+
+//--------------------------------------------------------------
+// @brief Function to fill a clipped block of pixels
+// @details Clips the block once against the viewport and fills it line by line
+//			with the span fill engine.
+//--------------------------------------------------------------
+static void VGA_FillRect(int32_t xp, int32_t yp, int32_t width, int32_t height, uint8_t color)
+{
+	if(!VGA_ClipRect(&xp, &yp, &width, &height))
+		return;
+
+	VGA_MarkDirty(xp, yp, xp + width - 1, yp + height - 1);
+	while(height--)
+		VGA_FillRun(xp, yp++, width, color);
 }
 
 //--------------------------------------------------------------
@@ -260,711 +1258,429 @@ void UB_VGA_DrawRectangle(uint16_t xp, uint16_t yp, uint8_t width, uint8_t heigh
 //--------------------------------------------------------------
 void UB_VGA_clearScreen()
 {
-  uint16_t xp,yp;
-
-  for(yp = 0; yp < VGA_DISPLAY_Y; yp++) {
-    for(xp = 0; xp < VGA_DISPLAY_X; xp++) {
-      UB_VGA_SetPixel(xp, yp, VGA_COL_WHITE);
-    }
-  }
+  UB_VGA_FillScreen(VGA_COL_WHITE);
 }
 
 //--------------------------------------------------------------
 // @brief Function load in a bitmap.
 // @details This function loads a designated bitmap on designated coordinates.
+//			The bitmap is clipped once against the viewport, after that only the
+//			rows and columns of the bitmap itself are written into the ram.
+//			Rows that are not clipped horizontally are expanded 4 pixels at a time.
 //
 // @param[in] x: The X-coordinate of the top left corner of the bitmap
 // @param[in] y: The Y-coordinate of the top left corner of the bitmap
 // @param[in] bmNr: The number ID of the bitmap to be loaded in
+// @param[in] color: The color of the set pixels, the other pixels are drawn white
+// @param[in] double_size: 0 = normal size, else every pixel is drawn as 2x2 pixels
 //--------------------------------------------------------------
 void UB_VGA_DrawBitmap(uint16_t x, uint16_t y, uint16_t bmNr, uint8_t color, uint8_t double_size)
 {
-  	uint16_t i; //Counts y coordinate VGA
-  	uint16_t j; //Counts x coordinate VGA
-  	uint8_t xBm; //Counts x of the bitmap
-  	uint8_t yBm; //Counts y of the bitmap
-  	uint16_t bmCoord;
-  	uint8_t doubleXFlag;
-  	uint8_t doubleYFlag;
-
-  	doubleXFlag = 0;
-  	doubleYFlag = 0;
-  	bmCoord = 0;
-  	yBm = 0;
-  	xBm = 0;
-
-  	for(i = 0; i < BM_AMOUNT; i++) //Look for bm ID
+  	uint16_t i;
+  	int32_t xp = x;
+  	int32_t yp = y;
+  	int32_t w;			//width on screen
+  	int32_t h;			//height on screen
+  	int32_t skipX;		//screen columns clipped away on the left
+  	int32_t skipY;		//screen rows clipped away on the top
+  	uint8_t shift;		//screen to bitmap coordinate: 0 = 1x, 1 = 2x
+  	uint16_t rowBytes;
+  	const BM_INFO_t *bm;
+  	const uint8_t *src;
+
+  	bm = Bitmap_find(bmNr);
+  	if(bm == NULL)
+  		return;
+
+  	shift = double_size ? 1 : 0;
+  	rowBytes = BM_ROW_BYTES(bm->x_len);
+  	w = bm->x_len << shift;
+  	h = bm->y_len << shift;
+
+  	if(!VGA_ClipRect(&xp, &yp, &w, &h))
+  		return;
+  	VGA_MarkDirty(xp, yp, xp + w - 1, yp + h - 1);
+  	skipX = xp - x;
+  	skipY = yp - y;
+
+  	for(i = 0; i < h; i++)
   	{
-  		if(bmNr == bmLookup[i][ID])
+  		src = &bitmap_1bpp[bm->offset + (((skipY + i) >> shift) * rowBytes)];
+
+  		if((w == (rowBytes * 8) << shift) && (skipX == 0))
+  		{
+  			// whole row visible: expand the row with the mask tables
+  			VGA_ExpandRow(xp, yp + i, src, rowBytes, shift, color);
+  		}
+  		else
   		{
-  			bmNr = i;
-  			break;
+  			VGA_ExpandPixels(xp, yp + i, src, skipX, w, shift, color);
   		}
   	}
+}
 
-  	bmCoord = bmLookup[bmNr][OFFSET];
 
-  	for(i = 0; i < VGA_DISPLAY_Y; i++)
+//--------------------------------------------------------------
+// @brief Expands one row of a 1bpp bitmap into the ram
+// @details Every nibble (or bit pair when drawn double size) is turned into a word of
+//			4 pixels: set pixels get the color, the others white. The words are
+//			stored with memcpy because a line in the ram is not word aligned.
+//			In 4bpp and 1bpp modes the row is expanded pixel by pixel.
+//
+// @param[in] xp The X-coordinate of the first pixel
+// @param[in] yp The Y-coordinate of the line
+// @param[in] src Pointer to the first byte of the bitmap row
+// @param[in] bytes The amount of bytes in the bitmap row
+// @param[in] shift 0 = normal size, 1 = double size
+// @param[in] color The color of the set pixels
+//--------------------------------------------------------------
+static void VGA_ExpandRow(int32_t xp, int32_t yp, const uint8_t *src, uint16_t bytes, uint8_t shift, uint8_t color)
+{
+  uint8_t *dst;
+  uint32_t fg = color * 0x01010101UL;
+  uint32_t mask;
+  uint32_t word;
+  uint8_t bits;
+  uint8_t n;
+
+  if(VGA.bpp != 8)
+  {
+    VGA_ExpandPixels(xp, yp, src, 0, (bytes * 8) << shift, shift, color);
+    return;
+  }
+
+  dst = &VGA.draw_buf[(yp * VGA.line_bytes) + xp];
+  while(bytes--)
+  {
+    bits = *src++;
+    if(shift)
     {
-  		if(i >= y)
-  		{
-  			if(yBm == bmLookup[bmNr][Y_LEN]) //Check for Y length of bm
-  				break;
-  			for(j = 0; j < VGA_DISPLAY_X; j++)
-  			{
-  				if(j >= x)
-  				{
-  					if(xBm == bmLookup[bmNr][X_LEN]) //Check for X length of bm
-  						break;
-
-  					if (color)
-  					{
-  						if (bitmap_test[bmCoord] == 0XFF)
-  						{
-  							UB_VGA_SetPixel(j, i, color);
-  						}
-  						else
-  							UB_VGA_SetPixel(j, i, 0xFF);
-  					}
-  					else
-  						UB_VGA_SetPixel(j, i, bitmap_test[bmCoord]);
-
-  					if(double_size && !doubleXFlag)
-  						doubleXFlag++;
-  					else
-  					{
-  						doubleXFlag--;
-  	  					xBm++;
-  	  					bmCoord++;
-  					}
-  				}
-	    	}
-  			xBm = 0;
-
-
-			if(double_size && !doubleYFlag)
-			{
-				doubleYFlag++;
-				bmCoord -= bmLookup[bmNr][X_LEN];
-			}
-			else
-			{
-				doubleYFlag--;
-				yBm++;
-			}
-  		}
+      for(n = 0; n < 4; n++)
+      {
+        mask = VGA_PairMask[bits >> 6];
+        word = (fg & mask) | ~mask;
+        memcpy(dst, &word, 4);
+        dst += 4;
+        bits <<= 2;
+      }
+    }
+    else
+    {
+      mask = VGA_NibbleMask[bits >> 4];
+      word = (fg & mask) | ~mask;
+      memcpy(dst, &word, 4);
+      mask = VGA_NibbleMask[bits & 0x0F];
+      word = (fg & mask) | ~mask;
+      memcpy(dst + 4, &word, 4);
+      dst += 8;
+    }
+  }
+}
+
+//--------------------------------------------------------------
+// @brief Expands a part of one row of a 1bpp bitmap into the ram
+// @details Pixel by pixel version of VGA_ExpandRow, used for clipped rows and 4bpp and 1bpp modes.
+//
+// @param[in] xp The X-coordinate of the first pixel
+// @param[in] yp The Y-coordinate of the line
+// @param[in] src Pointer to the first byte of the bitmap row
+// @param[in] bmX The first screen column relative to the bitmap (before scaling)
+// @param[in] len The amount of pixels to write
+// @param[in] shift 0 = normal size, 1 = double size
+// @param[in] color The color of the set pixels, the others are white
+//--------------------------------------------------------------
+static void VGA_ExpandPixels(int32_t xp, int32_t yp, const uint8_t *src, uint32_t bmX, uint16_t len, uint8_t shift, uint8_t color)
+{
+  uint8_t *dst;
+  uint32_t px;
+  uint8_t fg;
+  uint8_t bg;
+
+  if(VGA.bpp == 8)
+  {
+    dst = &VGA.draw_buf[(yp * VGA.line_bytes) + xp];
+    while(len--)
+    {
+      px = bmX++ >> shift;
+      *dst++ = (src[px >> 3] & (0x80 >> (px & 0x07))) ? color : 0xFF;
     }
+    return;
+  }
+
+  fg = VGA_IndexByte(color);
+  bg = VGA_IndexByte(VGA_COL_WHITE);
+  dst = &VGA.draw_buf[yp * VGA.line_bytes];
+  while(len--)
+  {
+    px = bmX++ >> shift;
+    VGA_PutIndex(dst, xp++, (src[px >> 3] & (0x80 >> (px & 0x07))) ? fg : bg);
+  }
 }
 
+
 //--------------------------------------------------------------
 // @brief Function write text on screen
-// @details This function checks the fontname, fontsize and fontstyle and prints the appropriate
-//			letter that fits the given parameters
-// @param[in] x_lup: The X-coordinate of the top left corner of the printed letter
-// @param[in] y_lup: The Y-coordinate of the top left corner of the printed letter
-// @param[in] color: The color code which the letter is printed in
+// @details This function looks up the glyph of every letter in the font table of the
+//			fontname and fontstyle and draws the whole text run line by line:
+//			per screen line one glyph row of every letter is expanded.
+//			The run is clipped once and ends at the string terminator.
+//			Letters without a glyph leave an empty space.
+//			Text modes: the letters are put in the cells from the cell at (x_lup, y_lup)
+//			on, with the background the cells had; font, size and style are ignored.
+//
+// @param[in] x_lup: The X-coordinate of the top left corner of the printed text
+// @param[in] y_lup: The Y-coordinate of the top left corner of the printed text
+// @param[in] color: The color code which the letters are printed in
 // @param[in] text: The text that has the be written on the screen
 // @param[in] fontname: The fontname that the text is printed in
-// @param[in] fontsize: The fontsize that the text is printed in
+// @param[in] fontsize: The fontsize that the text is printed in (2 = large)
 // @param[in] fontstyle: The fontstyle that the text is printed in
 //--------------------------------------------------------------
-void UB_VGA_writeText(uint16_t x_lup, uint16_t y_lup, uint8_t color, char text[20], char fontname, uint8_t fontsize, uint8_t fontstyle)
+void UB_VGA_writeText(uint16_t x_lup, uint16_t y_lup, uint8_t color, const char *text, uint8_t fontname, uint8_t fontsize, uint8_t fontstyle)
 {
-    uint16_t px = 0;
-    uint8_t i = 0;
-    uint8_t letterWidth = 0;
-    if(fontsize == 1)	//normal fontsize is selected
-    {
-        letterWidth = 8;
-    }
-    else if(fontsize == 2)	//large fontsize is selected
-    {
-        letterWidth = 16;
-    }
+  const uint8_t *glyph[VGA_TEXT_MAX];	// first byte of every glyph, NULL = no glyph
+  const BM_INFO_t *bm;
+  uint16_t n;							// amount of letters in the run
+  uint16_t i;
+  uint8_t shift;
+  int32_t advance;						// letter width on screen
+  int32_t xp = x_lup;
+  int32_t yp = y_lup;
+  int32_t w;
+  int32_t h;
+  int32_t skipX;
+  int32_t skipY;
+  int32_t px;							// screen column relative to the run
+  int32_t g;							// letter in the run
+  int32_t off;							// screen column relative to the letter
+  int32_t cnt;
+  uint16_t *cell;
 
+  if(VGA.bpp == 0)
+  {
+    if((x_lup / VGA_CELL_X >= VGA.cols) || (y_lup / VGA_CELL_Y >= VGA.rows))
+      return;
+    cell = (uint16_t *)VGA.draw_buf + ((y_lup / VGA_CELL_Y) * VGA.cols);
+    for(i = x_lup / VGA_CELL_X; (i < VGA.cols) && (*text != '\0'); i++)
+      cell[i] = (uint8_t)*text++ | (VGA_PalIndex[color] << 8) | (cell[i] & 0xF000);
+    return;
+  }
+
+  shift = (fontsize == 2) ? 1 : 0;
+  advance = TEXT_SIZE << shift;
+
+  // the glyphs of the run, only letters that can reach the screen
+  for(n = 0; (n < VGA_TEXT_MAX) && (text[n] != '\0'); n++)
+  {
+    bm = Bitmap_glyph(fontname, fontstyle, text[n]);
+    glyph[n] = (bm != NULL) ? &bitmap_1bpp[bm->offset] : NULL;
+  }
+
+  w = n * advance;
+  h = TEXT_SIZE << shift;
+  if(!VGA_ClipRect(&xp, &yp, &w, &h))
+    return;
+  VGA_MarkDirty(xp, yp, xp + w - 1, yp + h - 1);
+  skipX = xp - x_lup;
+  skipY = yp - y_lup;
 
-    for(i=0; i < 20; i++)	//maximum text size of 20 letters
+  for(i = 0; i < h; i++)
+  {
+    px = skipX;
+    while(px < skipX + w)
     {
-        px = x_lup + (i * letterWidth);	//changes the position of x
-        switch(text[i])
-        {
-            case 'a':	//if the letter is 'a'
-            	switch(fontname)	//checks what the fontname is
-            	{
-            		case ARIAL_FONT:	//arial font
-            			switch(fontstyle)	//checks what fontname is
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'a', color, fontsize); break;	//normal fontstyle
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'A', color, fontsize); break;	//bold fontstyle
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 0, color, fontsize); break;	//cursive fontstyle
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:	//consolas font
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 27, color, fontsize); break;	//normal fontstyle
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 500, color, fontsize); break;	//bold fontstyle
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 527, color, fontsize); break;	//cursive fontstyle
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'b':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'b', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'B', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 1, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 28, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 501, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 528, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'c':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'c', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'C', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 2, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 29, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 502, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 529, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'd':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'd', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'D', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 3, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 30, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 503, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 530, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'e':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'e', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'E', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 4, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 31, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 504, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 531, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'f':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'f', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'F', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 5, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 32, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 505, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 532, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'g':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'g', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'G', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 6, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 33, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 506, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 533, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'h':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'h', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'H', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 7, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 34, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 507, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 534, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'i':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'i', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'I', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 8, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 35, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 508, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 535, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'j':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'j', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'J', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 9, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 36, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 509, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 536, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'k':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'k', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'K', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 10, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 37, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 510, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 537, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'l':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'l', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'L', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 11, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 38, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 511, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 538, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'm':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'm', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'M', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 12, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 39, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 512, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 539, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'n':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'n', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'N', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 13, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 40, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 513, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 540, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'o':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'o', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'O', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 14, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 41, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 514, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 541, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'p':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'p', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'P', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 15, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 42, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 515, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 542, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'q':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'q', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'Q', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 16, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 43, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 516, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 543, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'r':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'r', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'R', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 17, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 44, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 517, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 544, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 's':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 's', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'S', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 18, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 45, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 518, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 545, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-            	break;
-            case 't':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 't', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'T', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 19, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 46, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 519, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 546, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'u':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'u', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'U', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 20, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 47, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 520, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 547, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'v':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'v', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'V', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 21, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 48, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 521, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 548, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'w':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'w', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'W', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 22, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 49, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 522, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 549, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'x':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'x', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'X', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 23, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 50, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 523, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 550, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'y':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'y', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'Y', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 24, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 51, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 524, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 551, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            case 'z':
-            	switch(fontname)
-            	{
-            		case ARIAL_FONT:
-            			switch(fontstyle)
-            			{
-            				case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'z', color, fontsize); break;
-            				case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 'Z', color, fontsize); break;
-            				case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 25, color, fontsize); break;
-            				default: break;
-            			}
-                	case CONSOLAS_FONT:
-                		switch(fontstyle)
-                		{
-                			case NORMAL_STYLE: UB_VGA_DrawBitmap(px, y_lup, 52, color, fontsize); break;
-                			case BOLD_STYLE: UB_VGA_DrawBitmap(px, y_lup, 525, color, fontsize); break;
-                			case CURSIVE_STYLE: UB_VGA_DrawBitmap(px, y_lup, 552, color, fontsize); break;
-                			default: break;
-                		}
-                	default: break;
-            	}
-                break;
-            default:
-                break;
+      g = px / advance;
+      off = px - (g * advance);
+      cnt = advance - off;
+      if(cnt > skipX + w - px)
+        cnt = skipX + w - px;
 
+      if(glyph[g] != NULL)
+      {
+        // glyphs of a font are TEXT_SIZE wide, one byte per row
+        if(cnt == advance)
+          VGA_ExpandRow(xp + px - skipX, yp + i, glyph[g] + ((skipY + i) >> shift), 1, shift, color);
+        else
+          VGA_ExpandPixels(xp + px - skipX, yp + i, glyph[g] + ((skipY + i) >> shift), off, cnt, shift, color);
+      }
 
-        }
+      px += cnt;
     }
+  }
+}
+
+
+//--------------------------------------------------------------
+// @brief Function to make a text mode attribute
+//
+// @param[in] color The 8-bit color of the character
+// @param[in] bgcolor The 8-bit color of the rest of the cell
+//
+// @return the attribute, the nearest palette entries of both colors
+//--------------------------------------------------------------
+uint8_t UB_VGA_TextAttr(uint8_t color, uint8_t bgcolor)
+{
+  return VGA_ATTR(VGA_PalIndex[color], VGA_PalIndex[bgcolor]);
+}
+
+
+//--------------------------------------------------------------
+// @brief Function to put one character in a cell (text modes)
+// @details One store of 2 bytes, shown from the next scanline on.
+//			Does nothing outside the cells or in the other modes.
+//
+// @param[in] col The column of the cell
+// @param[in] row The row of the cell
+// @param[in] c The character, ASCII
+// @param[in] attr The colors, see UB_VGA_TextAttr
+//--------------------------------------------------------------
+void UB_VGA_PutChar(uint8_t col, uint8_t row, char c, uint8_t attr)
+{
+  if((col >= VGA.cols) || (row >= VGA.rows))
+    return;
+  ((uint16_t *)VGA.draw_buf)[(row * VGA.cols) + col] = (uint8_t)c | (attr << 8);
+}
+
+
+//--------------------------------------------------------------
+// @brief Function to put a text in the cells of one row (text modes)
+// @details The text is cut off at the end of the row.
+//
+// @param[in] col The column of the first cell
+// @param[in] row The row of the cells
+// @param[in] text The text, '\0' terminated
+// @param[in] attr The colors, see UB_VGA_TextAttr
+//--------------------------------------------------------------
+void UB_VGA_PutText(uint8_t col, uint8_t row, const char *text, uint8_t attr)
+{
+  uint16_t *cell;
+
+  if(row >= VGA.rows)
+    return;
+  cell = (uint16_t *)VGA.draw_buf + (row * VGA.cols);
+  for(; (col < VGA.cols) && (*text != '\0'); col++)
+    cell[col] = (uint8_t)*text++ | (attr << 8);
+}
+
+
+//--------------------------------------------------------------
+// @brief Function to scroll the cells up (text modes)
+// @details Moves the cells rows up with one memmove, the rows at the bottom
+//			become empty cells. Scrolling all rows clears the screen.
+//
+// @param[in] rows The amount of rows to scroll
+// @param[in] attr The colors of the empty cells, see UB_VGA_TextAttr
+//--------------------------------------------------------------
+void UB_VGA_ScrollText(uint8_t rows, uint8_t attr)
+{
+  uint16_t *cell = (uint16_t *)VGA.draw_buf;
+  uint16_t keep;
+  uint16_t n;
+
+  if(rows > VGA.rows)
+    rows = VGA.rows;
+  keep = (VGA.rows - rows) * VGA.cols;
+  memmove(cell, cell + (rows * VGA.cols), keep * 2);
+  for(n = keep; n < VGA.rows * VGA.cols; n++)
+    cell[n] = ' ' | (attr << 8);
+}
+
+
+//--------------------------------------------------------------
+// @brief Function to set a sprite
+// @details A sprite is a bitmap that is drawn over the picture at scanout time,
+//			the picture in the buffer stays as it is. The clear bits of the bitmap
+//			are the colour key, the picture shows through them. A sprite with a
+//			higher z is drawn on top, with the same z the higher number.
+//			The sprite is shown from the next frame on, at the place of the last
+//			UB_VGA_MoveSprite (0,0 at first).
+//
+// @param[in] nr The sprite, 0..VGA_SPRITE_MAX-1
+// @param[in] bmNr The number ID of the bitmap, see UB_VGA_DrawBitmap
+// @param[in] color The 8-bit color of the set bits
+// @param[in] z The order of the sprites
+//
+// @return 0 when the sprite or the bitmap doesn't exist (the sprite is hidden), else 1
+//--------------------------------------------------------------
+uint8_t UB_VGA_SetSprite(uint8_t nr, uint16_t bmNr, uint8_t color, uint8_t z)
+{
+  const BM_INFO_t *bm = Bitmap_find(bmNr);
+
+  if(nr >= VGA_SPRITE_MAX)
+    return 0;
+  if(bm == NULL)
+  {
+    VGA_Sprite[nr].src = NULL;
+    return 0;
+  }
+
+  VGA_SpriteBusy = 1;
+  VGA_Sprite[nr].w = bm->x_len;
+  VGA_Sprite[nr].h = bm->y_len;
+  VGA_Sprite[nr].color = color;
+  VGA_Sprite[nr].z = z;
+  VGA_Sprite[nr].src = &bitmap_1bpp[bm->offset];
+  VGA_SpriteBusy = 0;
+  return 1;
+}
+
+
+//--------------------------------------------------------------
+// @brief Function to move a sprite
+// @details Only the place is stored, the sprite is drawn there from the next
+//			frame on. Nothing in the buffers is redrawn.
+//
+// @param[in] nr The sprite, 0..VGA_SPRITE_MAX-1
+// @param[in] x The X-coordinate of the top left corner, may be outside the screen
+// @param[in] y The Y-coordinate of the top left corner, may be outside the screen
+//--------------------------------------------------------------
+void UB_VGA_MoveSprite(uint8_t nr, int16_t x, int16_t y)
+{
+  if(nr >= VGA_SPRITE_MAX)
+    return;
+  VGA_SpriteBusy = 1;
+  VGA_Sprite[nr].x = x;
+  VGA_Sprite[nr].y = y;
+  VGA_SpriteBusy = 0;
 }
 
+
+//--------------------------------------------------------------
+// @brief Function to hide a sprite, from the next frame on
+//--------------------------------------------------------------
+void UB_VGA_HideSprite(uint8_t nr)
+{
+  if(nr < VGA_SPRITE_MAX)
+    VGA_Sprite[nr].src = NULL;
+}
+
+
+//--------------------------------------------------------------
+// @brief Takes the sprites over for the next frame (called from UB_VGA_StartFrame)
+// @details Copies the visible sprites into VGA_SpriteShow, sorted on z with the
+//			bottom one first, so the scanout only walks the sprites in order and
+//			a move halfway the frame shows up in the next one.
+//			When the frame starts while the main loop is writing a sprite (VGA_SpriteBusy),
+//			the sprites of the last frame are shown once more, never a half written one.
+//--------------------------------------------------------------
+void UB_VGA_LatchSprites(void)
+{
+  VGA_SPRITE_t s;
+  uint8_t nr;
+  uint8_t i;
+
+  if(VGA_SpriteBusy)
+    return;
+
+  VGA_SpriteCnt = 0;
+  for(nr = 0; nr < VGA_SPRITE_MAX; nr++)
+  {
+    s = VGA_Sprite[nr];
+    if(s.src == NULL)
+      continue;
+    for(i = VGA_SpriteCnt; (i > 0) && (VGA_SpriteShow[i - 1].z > s.z); i--)
+      VGA_SpriteShow[i] = VGA_SpriteShow[i - 1];
+    VGA_SpriteShow[i] = s;
+    VGA_SpriteCnt++;
+  }
+}
@@ -33,10 +33,10 @@
 #define  VGA_COL_CYAN           0x1F
 #define  VGA_COL_LIGHTCYAN      0x75
 #define  VGA_COL_MAGENTA        0xE3
-#define  VGA_COL_LIGHTMAGENTA	0x00
+#define  VGA_COL_LIGHTMAGENTA	0xEF
 #define  VGA_COL_YELLOW         0xFC
-#define  VGA_COL_BROWN    		0x00
-#define  VGA_COL_GRAY			0x00
+#define  VGA_COL_BROWN    		0x88
+#define  VGA_COL_GRAY			0x92
 
 
 #define ARIAL_FONT	1
@@ -46,12 +46,62 @@
 #define BOLD_STYLE 2
 #define CURSIVE_STYLE 3
 
+#define VGA_TEXT_MAX (VGA_MAX_X / 8)  // letters of one text run that fit on a line
+
+#define VGA_DIRTY_MAX  8   // dirty areas kept, more are merged
+
+#define VGA_SPRITE_MAX 8   // sprites, see UB_VGA_SetSprite
+
+// Called while waiting for the TIM2 interrupt (UB_VGA_WaitVBlank),
+// the host build plays the vertical blank here
+#ifndef VGA_WAIT_HOOK
+#define VGA_WAIT_HOOK()
+#endif
+
 
 //--------------------------------------------------------------
-// define the VGA_display
+// Video modes (UB_VGA_SetMode)
+// All modes share VGA_RAM1 and the 640x480 VGA timing: a row is shown on
+// 1 << row_shift lines, the pixel clock makes every row as wide as the screen.
+//
+// 8bpp: one line in VGA_RAM1 = visible pixels + 1 blanking byte (black),
+//       the DMA reads it directly
+// 4bpp: 2 pixels per byte, the even pixel in the low nibble
+// 1bpp: 8 pixels per byte, the most left pixel in bit 0
+//       4bpp and 1bpp are palette indexed, a line is expanded for the DMA
+// text: a cell of VGA_CELL_X x VGA_CELL_Y pixels per character (bpp = 0),
+//       see UB_VGA_PutChar; the glyph rows come from font_8x8 at scanline time
 //--------------------------------------------------------------
-#define VGA_DISPLAY_X   320
-#define VGA_DISPLAY_Y   240
+#define VGA_MODE_320x240x8   0   // one 8-bit buffer
+#define VGA_MODE_320x240x4   1   // two 16 color buffers, see UB_VGA_Swap
+#define VGA_MODE_320x480x4   2   // one 16 color buffer
+#define VGA_MODE_640x480x1   3   // two 2 color buffers, see UB_VGA_Swap
+#define VGA_MODE_160x120x8   4   // one 8-bit buffer, most of VGA_RAM1 stays free
+#define VGA_MODE_80x30       5   // text, 80x30 cells of 16 colors on 640x240 pixels
+#define VGA_MODE_40x30       6   // text, 40x30 cells of 16 colors on 320x240 pixels
+#define VGA_MODE_COUNT       7
+
+#define VGA_START_MODE    VGA_MODE_320x240x8   // video mode after UB_VGA_Screen_Init
+#define VGA_PAL_SIZE      16
+
+#define VGA_MAX_X       640   // the widest mode
+#define VGA_MAX_Y       480   // the highest mode
+#define VGA_RAM_BYTES   ((320 + 1) * 240)  // the largest mode (320x240x8)
+
+#define VGA_CELL_X      8     // text modes: pixels per cell
+#define VGA_CELL_Y      8     // text modes: rows per cell (shown on 16 lines)
+
+// text modes: the attribute of a cell, fg and bg are palette indices
+#define VGA_ATTR(fg, bg)  ((uint8_t)(((bg) << 4) | (fg)))
+
+typedef struct {
+  uint16_t width;       // pixels per row
+  uint16_t height;      // rows
+  uint8_t bpp;          // bits per pixel: 8, 4 or 1, 0 = text
+  uint8_t buffers;      // 2 = draw in one buffer while the other is shown
+  uint8_t row_shift;    // every row is shown on 1 << row_shift lines
+  uint8_t tim1_periode; // pixel clock = 168MHz / (tim1_periode + 1), tim1_periode odd
+}VGA_MODE_t;
 
 
 
@@ -60,17 +110,43 @@
 //--------------------------------------------------------------
 typedef struct {
   uint16_t hsync_cnt;   // counter
-  uint32_t start_adr;   // start_adres
-  uint32_t dma2_cr_reg; // Register constant CR-Register
+  uint32_t start_adr;   // start_adres of the next line
+  uint8_t mode;         // video mode, VGA_MODE_...
+  uint16_t width;       // pixels per row
+  uint16_t height;      // rows
+  uint16_t line_bytes;  // bytes per row in the buffer
+  uint8_t bpp;          // bits per pixel, 8, 4 or 1, 0 = text
+  uint8_t cols;         // text modes: cells per row
+  uint8_t rows;         // text modes: rows of cells
+  uint8_t px_shift;     // 4bpp and 1bpp: pixel -> byte in the row (1 or 3)
+  uint8_t row_shift;    // every row is shown on 1 << row_shift lines
+  uint8_t tim1_periode; // pixel clock, TIM1->ARR
+  uint16_t gate_stop;   // end of the line, TIM3->ARR
+  uint8_t *draw_buf;    // buffer the draw functions write to
+  uint8_t *show_buf;    // buffer the DMA shows
+  volatile uint8_t swap; // 1 = swap draw_buf and show_buf in the next vertical blank
+  volatile uint8_t drawing; // 1 = the main loop draws, the swap waits (UB_VGA_StartDraw)
+  volatile uint16_t frame; // frame counter, counts at VGA_VSYNC_BILD_STOP (start of the vertical blank)
 }VGA_t;
 extern VGA_t VGA;
 
 
+//--------------------------------------------------------------
+// Viewport (clip window), all bounds are inclusive
+//--------------------------------------------------------------
+typedef struct {
+  int16_t x0;   // left
+  int16_t y0;   // top
+  int16_t x1;   // right
+  int16_t y1;   // bottom
+}VGA_VIEWPORT_t;
+
+
 
 //--------------------------------------------------------------
 // Display RAM
 //--------------------------------------------------------------
-extern uint8_t VGA_RAM1[(VGA_DISPLAY_X+1)*VGA_DISPLAY_Y];
+extern uint8_t VGA_RAM1[VGA_RAM_BYTES];
 
 
 
@@ -80,6 +156,7 @@ extern uint8_t VGA_RAM1[(VGA_DISPLAY_X+1)*VGA_DISPLAY_Y];
 //
 // basefreq = 2*APB2 (APB2=84MHz) => TIM_CLK=168MHz
 // Frq       = 168MHz/1/12 = 14MHz
+// The video mode sets the period from the next frame on (28MHz, 14MHz or 7MHz)
 //
 //--------------------------------------------------------------
 #define VGA_TIM1_PERIODE      11
@@ -102,8 +179,25 @@ extern uint8_t VGA_RAM1[(VGA_DISPLAY_X+1)*VGA_DISPLAY_Y];
 
 #define  VGA_TIM2_HSYNC_IMP        320  // HSync-length (3,81us)
 #define  VGA_TIM2_HTRIGGER_START   480  // HSync+BackPorch (5,71us)
-#define  VGA_TIM2_DMA_DELAY         37  // ease the delay when DMA START (Optimization = none)
-// #define  VGA_TIM2_DMA_DELAY         30  // ease the delay when DMA START (Optimization = -O1)
+
+
+//--------------------------------------------------------------
+// Timer-3
+// Function  = Gate of Timer-1, open for one line of pixels
+//             Started by the Timer-2 update (trigger mode, one pulse mode)
+//             OC1REF (PWM2) => TRGO => Timer-1 (gated mode)
+//
+// basefreq = 2*APB1 (APB1=48MHz) => TIM_CLK=84MHz
+// 1 pixel   = (tim1_periode + 1) Timer-1 ticks = (tim1_periode + 1) / 2 Timer-3 ticks
+// The gate is open for exactly width + 1 pixels (the blanking byte), so every
+// line makes the same number of DMA requests, whatever the optimization.
+// The end of the gate (VGA.gate_stop) depends on the video mode, the period
+// of MX_TIM3_Init is the one of VGA_START_MODE (320 pixels, VGA_TIM1_PERIODE).
+// The update at the end of the gate checks the stream (UB_VGA_LineEnd).
+//--------------------------------------------------------------
+#define  VGA_TIM3_GATE_START      VGA_TIM2_HTRIGGER_START
+#define  VGA_TIM3_GATE_STOP       (VGA_TIM3_GATE_START + ((320 + 1) * (VGA_TIM1_PERIODE + 1) / 2) - 1)
+#define  VGA_TIM3_PRESCALE           0
 
 
 //--------------------------------------------------------------
@@ -114,7 +208,7 @@ extern uint8_t VGA_RAM1[(VGA_DISPLAY_X+1)*VGA_DISPLAY_Y];
 #define  VGA_VSYNC_PERIODE         525
 #define  VGA_VSYNC_IMP               2
 #define  VGA_VSYNC_BILD_START       36
-#define  VGA_VSYNC_BILD_STOP       514   // (16,38ms)
+#define  VGA_VSYNC_BILD_STOP       515   // (16,36ms), 480 lines from VGA_VSYNC_BILD_START on
 
 
 //--------------------------------------------------------------
@@ -140,10 +234,34 @@ extern uint8_t VGA_RAM1[(VGA_DISPLAY_X+1)*VGA_DISPLAY_Y];
 void UB_VGA_Screen_Init(void);
 void UB_VGA_FillScreen(uint8_t color);
 void UB_VGA_SetPixel(uint16_t xp, uint16_t yp, uint8_t color);
+void UB_VGA_FillSpan(uint16_t xp, uint16_t yp, uint16_t len, uint8_t color);
+uint8_t UB_VGA_SetMode(uint8_t mode);
+uint8_t *UB_VGA_GetFreeRam(uint32_t *len);
+void UB_VGA_SetPalette(uint8_t index, uint8_t color);
+void UB_VGA_StartDraw(void);
+void UB_VGA_Swap(void);
+void UB_VGA_WaitVBlank(void);
+void UB_VGA_StartFrame(void);
+void UB_VGA_LineEnd(void);
+uint32_t UB_VGA_ScanLine(uint16_t yp);
+uint32_t UB_VGA_ExpandLine(uint16_t yp);
+uint8_t UB_VGA_GetDirty(const VGA_VIEWPORT_t **rects);
+void UB_VGA_ClearDirty(void);
+void UB_VGA_SetViewport(uint16_t xp, uint16_t yp, uint16_t width, uint16_t height);
+void UB_VGA_ResetViewport(void);
 void UB_VGA_SetLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t color, uint16_t width);
-void UB_VGA_DrawRectangle(uint16_t xp, uint16_t yp, uint8_t width, uint8_t height, uint8_t color, uint8_t filled,
+void UB_VGA_DrawRectangle(uint16_t xp, uint16_t yp, uint16_t width, uint16_t height, uint8_t color, uint8_t filled,
         uint8_t bordercolor, uint8_t lineWidth);
 void UB_VGA_DrawBitmap(uint16_t x, uint16_t y, uint16_t bmNr, uint8_t color, uint8_t double_size);
+void UB_VGA_writeText(uint16_t x_lup, uint16_t y_lup, uint8_t color, const char *text, uint8_t fontname, uint8_t fontsize, uint8_t fontstyle);
+uint8_t UB_VGA_TextAttr(uint8_t color, uint8_t bgcolor);
+void UB_VGA_PutChar(uint8_t col, uint8_t row, char c, uint8_t attr);
+void UB_VGA_PutText(uint8_t col, uint8_t row, const char *text, uint8_t attr);
+void UB_VGA_ScrollText(uint8_t rows, uint8_t attr);
+uint8_t UB_VGA_SetSprite(uint8_t nr, uint16_t bmNr, uint8_t color, uint8_t z);
+void UB_VGA_MoveSprite(uint8_t nr, int16_t x, int16_t y);
+void UB_VGA_HideSprite(uint8_t nr);
+void UB_VGA_LatchSprites(void);
 
 
 void UB_VGA_clearScreen();
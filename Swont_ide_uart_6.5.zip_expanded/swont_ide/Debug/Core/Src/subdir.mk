@@ -9,7 +9,9 @@ C_SRCS += \
 ../Core/Src/bitmap.c \
 ../Core/Src/dma.c \
 ../Core/Src/gpio.c \
+../Core/Src/isr_stats.c \
 ../Core/Src/logic_layer.c \
+../Core/Src/macro.c \
 ../Core/Src/main.c \
 ../Core/Src/stm32f4xx_hal_msp.c \
 ../Core/Src/stm32f4xx_it.c \
@@ -24,7 +26,9 @@ OBJS += \
 ./Core/Src/bitmap.o \
 ./Core/Src/dma.o \
 ./Core/Src/gpio.o \
+./Core/Src/isr_stats.o \
 ./Core/Src/logic_layer.o \
+./Core/Src/macro.o \
 ./Core/Src/main.o \
 ./Core/Src/stm32f4xx_hal_msp.o \
 ./Core/Src/stm32f4xx_it.o \
@@ -39,7 +43,9 @@ C_DEPS += \
 ./Core/Src/bitmap.d \
 ./Core/Src/dma.d \
 ./Core/Src/gpio.d \
+./Core/Src/isr_stats.d \
 ./Core/Src/logic_layer.d \
+./Core/Src/macro.d \
 ./Core/Src/main.d \
 ./Core/Src/stm32f4xx_hal_msp.d \
 ./Core/Src/stm32f4xx_it.d \
@@ -57,7 +63,7 @@ Core/Src/%.o Core/Src/%.su: ../Core/Src/%.c Core/Src/subdir.mk
 clean: clean-Core-2f-Src
 
 clean-Core-2f-Src:
-	-$(RM) ./Core/Src/Frontlayer.d ./Core/Src/Frontlayer.o ./Core/Src/Frontlayer.su ./Core/Src/bitmap.d ./Core/Src/bitmap.o ./Core/Src/bitmap.su ./Core/Src/dma.d ./Core/Src/dma.o ./Core/Src/dma.su ./Core/Src/gpio.d ./Core/Src/gpio.o ./Core/Src/gpio.su ./Core/Src/logic_layer.d ./Core/Src/logic_layer.o ./Core/Src/logic_layer.su ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/stm32f4xx_hal_msp.d ./Core/Src/stm32f4xx_hal_msp.o ./Core/Src/stm32f4xx_hal_msp.su ./Core/Src/stm32f4xx_it.d ./Core/Src/stm32f4xx_it.o ./Core/Src/stm32f4xx_it.su ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f4xx.d ./Core/Src/system_stm32f4xx.o ./Core/Src/system_stm32f4xx.su ./Core/Src/tim.d ./Core/Src/tim.o ./Core/Src/tim.su ./Core/Src/usart.d ./Core/Src/usart.o ./Core/Src/usart.su
+	-$(RM) ./Core/Src/Frontlayer.d ./Core/Src/Frontlayer.o ./Core/Src/Frontlayer.su ./Core/Src/bitmap.d ./Core/Src/bitmap.o ./Core/Src/bitmap.su ./Core/Src/dma.d ./Core/Src/dma.o ./Core/Src/dma.su ./Core/Src/gpio.d ./Core/Src/gpio.o ./Core/Src/gpio.su ./Core/Src/isr_stats.d ./Core/Src/isr_stats.o ./Core/Src/isr_stats.su ./Core/Src/logic_layer.d ./Core/Src/logic_layer.o ./Core/Src/logic_layer.su ./Core/Src/macro.d ./Core/Src/macro.o ./Core/Src/macro.su ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/stm32f4xx_hal_msp.d ./Core/Src/stm32f4xx_hal_msp.o ./Core/Src/stm32f4xx_hal_msp.su ./Core/Src/stm32f4xx_it.d ./Core/Src/stm32f4xx_it.o ./Core/Src/stm32f4xx_it.su ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f4xx.d ./Core/Src/system_stm32f4xx.o ./Core/Src/system_stm32f4xx.su ./Core/Src/tim.d ./Core/Src/tim.o ./Core/Src/tim.su ./Core/Src/usart.d ./Core/Src/usart.o ./Core/Src/usart.su
 
 .PHONY: clean-Core-2f-Src
 
@@ -0,0 +1,239 @@
+/*
+ * bench.c
+ *
+ *  Created on: 17 okt. 2026
+ *
+ * Command throughput benchmark of the host build.
+ * Every script is sent through the UART receive path, FL_Input and logic like on the board.
+ * Per script it prints the commands per second (receive path included), the latency
+ * percentiles of FL_Input + logic per function and the checksum of VGA_RAM1.
+ *
+ * usage: bench [-n runs] [-m mode] script...
+ *   -n runs: send every script this many times (default 100)
+ *   -m mode: the video mode, as the mode command (default 320x240x8)
+ */
+#include "main.h"
+#include "Frontlayer.h"
+#include "logic_layer.h"
+#include "stm32_ub_vga_screen.h"
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_TYPES 10
+
+typedef struct
+{
+	char function;		//fl_function
+	const char *name;
+	uint64_t *ns;		//the latency of every command
+	uint32_t count;
+	uint32_t size;
+}BENCH_S;
+
+static BENCH_S bench[BENCH_TYPES] =
+{
+	{line, "line"},
+	{rectangle, "rectangle"},
+	{text, "text"},
+	{bitmap, "bitmap"},
+	{clearscreen, "clearscreen"},
+	{batchBegin, "begin"},
+	{batchCommit, "commit"},
+	{macroPlay, "play"},
+	{macroRecord, "macro"},	//record, save, list and erase
+	{0, "other"},
+};
+
+static uint64_t benchNow(void);
+static void benchLine(void);
+static void benchAdd(char function, uint64_t ns);
+static int benchCompare(const void *a, const void *b);
+static void benchReport(void);
+static uint8_t *benchRead(const char *path, uint32_t *len);
+
+int main(int argc, char *argv[])
+{
+	uint32_t runs = 100;
+	int mode = VGA_START_MODE;
+	uint8_t *script;
+	uint32_t len;
+	uint32_t run;
+	uint32_t commands;
+	uint64_t start;
+	uint64_t ns;
+	uint8_t i;
+	int opt;
+
+	while((opt = getopt(argc, argv, "n:m:")) != -1)
+	{
+		if(opt == 'n')
+			runs = strtoul(optarg, NULL, 0);
+		else if(opt == 'm')
+		{
+			mode = mode_check(optarg);
+			if(mode < 0)
+			{
+				fprintf(stderr, "%s: unknown mode %s\n", argv[0], optarg);
+				return 2;
+			}
+		}
+		else
+		{
+			fprintf(stderr, "usage: %s [-n runs] [-m mode] script...\n", argv[0]);
+			return 2;
+		}
+	}
+	if((optind >= argc) || (runs == 0))
+	{
+		fprintf(stderr, "usage: %s [-n runs] [-m mode] script...\n", argv[0]);
+		return 2;
+	}
+
+	for(; optind < argc; optind++)
+	{
+		script = benchRead(argv[optind], &len);
+		Host_Init(mode);
+		for(i = 0; i < BENCH_TYPES; i++)
+			bench[i].count = 0;
+
+		start = benchNow();
+		for(run = 0; run < runs; run++)
+			Host_Feed(script, len, benchLine);
+		ns = benchNow() - start;
+
+		commands = 0;
+		for(i = 0; i < BENCH_TYPES; i++)
+			commands += bench[i].count;
+		printf("%s: %u runs, %ux%ux%u, %u bytes\n", argv[optind], runs, VGA.width, VGA.height, VGA.bpp, len);
+		printf("  %u commands in %.3f ms = %.0f commands/s\n", commands, ns / 1e6, commands * 1e9 / ns);
+		benchReport();
+		printf("  checksum %016llx\n", (unsigned long long)Host_Checksum());
+		free(script);
+	}
+
+	return 0;
+}
+
+//--------------------------------------------------------------
+// @brief Function gives the time in ns
+//--------------------------------------------------------------
+static uint64_t benchNow(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint64_t)t.tv_sec * 1000000000u + t.tv_nsec;
+}
+
+//--------------------------------------------------------------
+// @brief Function handles a line like the main loop and times every command
+//--------------------------------------------------------------
+static void benchLine(void)
+{
+	uint64_t start;
+	char function;
+
+	for(;;)
+	{
+		start = benchNow();
+		if(FL_Input() == false)
+			break;
+		function = fl_function;	//commit changes fl_function while it draws the batch
+		logic();
+		benchAdd(function, benchNow() - start);
+	}
+}
+
+//--------------------------------------------------------------
+// @brief Function stores the latency of a command
+//
+// @param[in] function: fl_function of the command
+// @param[in] ns: The latency
+//--------------------------------------------------------------
+static void benchAdd(char function, uint64_t ns)
+{
+	BENCH_S *b = &bench[BENCH_TYPES - 1];
+	uint8_t i;
+
+	if((function == macroSave) || (function == macroList) || (function == macroErase))
+		function = macroRecord;
+	for(i = 0; i < BENCH_TYPES - 1; i++)
+	{
+		if(bench[i].function == function)
+		{
+			b = &bench[i];
+			break;
+		}
+	}
+
+	if(b->count == b->size)
+	{
+		b->size = (b->size != 0) ? b->size * 2 : 1024;
+		b->ns = realloc(b->ns, b->size * sizeof(b->ns[0]));
+		if(b->ns == NULL)
+		{
+			perror("bench");
+			exit(1);
+		}
+	}
+	b->ns[b->count++] = ns;
+}
+
+static int benchCompare(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a;
+	uint64_t y = *(const uint64_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+//--------------------------------------------------------------
+// @brief Function prints the latency percentiles of every function that was sent
+//--------------------------------------------------------------
+static void benchReport(void)
+{
+	BENCH_S *b;
+	uint8_t i;
+
+	printf("  %-12s %8s %9s %9s %9s %9s\n", "function", "count", "p50 ns", "p90 ns", "p99 ns", "max ns");
+	for(i = 0; i < BENCH_TYPES; i++)
+	{
+		b = &bench[i];
+		if(b->count == 0)
+			continue;
+		qsort(b->ns, b->count, sizeof(b->ns[0]), benchCompare);
+		printf("  %-12s %8u %9llu %9llu %9llu %9llu\n", b->name, b->count,
+			   (unsigned long long)b->ns[b->count / 2],
+			   (unsigned long long)b->ns[(uint64_t)b->count * 90 / 100],
+			   (unsigned long long)b->ns[(uint64_t)b->count * 99 / 100],
+			   (unsigned long long)b->ns[b->count - 1]);
+	}
+}
+
+//--------------------------------------------------------------
+// @brief Function reads a script, the bytes are sent as they are
+// @details Lines end with CR (or '.') like from a terminal, LF is ignored by the firmware.
+//--------------------------------------------------------------
+static uint8_t *benchRead(const char *path, uint32_t *len)
+{
+	FILE *f = fopen(path, "rb");
+	uint8_t *data;
+	long size;
+
+	if((f == NULL) || (fseek(f, 0, SEEK_END) != 0) || ((size = ftell(f)) < 0))
+	{
+		perror(path);
+		exit(1);
+	}
+	rewind(f);
+	data = malloc(size + 1);
+	if((data == NULL) || (fread(data, 1, size, f) != (size_t)size))
+	{
+		perror(path);
+		exit(1);
+	}
+	fclose(f);
+	*len = size;
+	return data;
+}
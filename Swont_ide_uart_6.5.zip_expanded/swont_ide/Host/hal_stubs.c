@@ -0,0 +1,359 @@
+/*
+ * hal_stubs.c
+ *
+ *  Created on: 17 okt. 2026
+ *
+ * The hardware of the host build: HAL stubs, RAM for the peripheral registers the
+ * firmware touches, the macro flash sector and the vertical blank of TIM2_IRQHandler.
+ */
+#include "main.h"
+#include "usart.h"
+#include "tim.h"
+#include "stm32_ub_vga_screen.h"
+#include "macro.h"
+#include "Frontlayer.h"
+#include "logic_layer.h"
+#include <stdlib.h>
+#include <sys/mman.h>
+
+// Defined by main.c, tim.c and stm32f4xx_it.c in the firmware
+input_vars input;
+TIM_HandleTypeDef htim1;
+TIM_HandleTypeDef htim2;
+TIM_HandleTypeDef htim3;
+DMA_HandleTypeDef hdma_tim1_up;
+
+static TIM_TypeDef host_tim2;
+static USART_TypeDef host_usart2;
+static DMA_Stream_TypeDef host_dma_rx;
+static DMA_Stream_TypeDef host_dma_tx;
+static uint32_t host_dma_rx_pos;	//next byte the "DMA" writes into input.dma_buffer_rx
+
+#define HOST_FRAME_BYTES 192		//bytes the UART receives in one frame: 115200 baud, 10 bits a byte, 60 Hz
+static const uint8_t *host_feed;	//bytes of Host_Feed the UART didn't receive yet
+static uint32_t host_feed_len;
+static uint32_t host_frame_bytes;	//bytes received since the last vertical blank
+static uint32_t host_time;			//the time in bytes of the UART, see HAL_GetTick
+
+static char host_uart[4096];		//what the firmware sent, see Host_UartOutput
+static uint32_t host_uart_len;
+
+static void hostReceive(void);
+
+//--------------------------------------------------------------
+// @brief Function starts the host hardware
+// @details Maps the macro flash sector and the flash registers at their STM32 addresses
+//			(empty flash), starts the UART receive, hides the sprites and selects the
+//			video mode, which clears the screen to white. Calling it again starts over, so every test
+//			starts from the same state.
+//
+// @param[in] mode: The video mode, VGA_MODE_...
+//--------------------------------------------------------------
+void Host_Init(uint8_t mode)
+{
+	uint8_t i;
+
+	if((mmap((void *)MACRO_START, MACRO_END - MACRO_START, PROT_READ | PROT_WRITE,
+			 MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) == MAP_FAILED) ||
+	   (mmap((void *)(FLASH_R_BASE & ~0xFFFu), 0x1000, PROT_READ | PROT_WRITE,
+			 MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) == MAP_FAILED))
+	{
+		perror("host: mmap");
+		exit(1);
+	}
+	memset((void *)MACRO_START, 0xFF, MACRO_END - MACRO_START);
+
+	memset(&input, 0, sizeof(input));
+	htim2.Instance = &host_tim2;
+	host_tim2.DIER = TIM_IT_CC3;
+	huart2.Instance = &host_usart2;
+	hdma_usart2_rx.Instance = &host_dma_rx;
+	hdma_usart2_tx.Instance = &host_dma_tx;
+	host_dma_rx.NDTR = RX_DMA_BUFLEN;
+	host_dma_rx_pos = 0;
+	host_feed_len = 0;
+	host_frame_bytes = 0;
+	UART_RxStart();
+	Host_UartClear();
+
+	for(i = 0; i < VGA_SPRITE_MAX; i++)
+	{
+		UB_VGA_HideSprite(i);
+		UB_VGA_MoveSprite(i, 0, 0);
+	}
+	UB_VGA_SetMode(mode);
+}
+
+//--------------------------------------------------------------
+// @brief Function sends bytes to the firmware, the way main() handles them
+// @details The bytes arrive at the speed of the UART (HOST_FRAME_BYTES a frame), in
+//			chunks of half the receive DMA buffer, see hostReceive. After every chunk the
+//			queued lines are handled between UB_VGA_StartDraw and UB_VGA_Swap, like the
+//			main loop does. When the bytes are sent the frame ends, so the picture is shown.
+//
+// @param[in] data: The bytes
+// @param[in] len: The amount of bytes
+// @param[in] run_line: Handles the current line, NULL = while(FL_Input()) logic();
+//--------------------------------------------------------------
+void Host_Feed(const uint8_t *data, uint32_t len, void (*run_line)(void))
+{
+	host_feed = data;
+	host_feed_len = len;
+	while(host_feed_len > 0)
+	{
+		hostReceive();
+		if(UART_GetLine() == FALSE)
+			continue;
+
+		UB_VGA_StartDraw();
+		do
+		{
+			if(run_line != NULL)
+				run_line();
+			else
+				while(FL_Input() == true)
+					logic();
+			UART_ReleaseLine();
+		}
+		while(UART_GetLine() == TRUE);
+		UB_VGA_Swap();
+	}
+	Host_Wait();
+}
+
+//--------------------------------------------------------------
+// @brief Function lets the time pass until the next vertical blank (VGA_WAIT_HOOK)
+// @details The UART receives the bytes of Host_Feed that arrive meanwhile, like the
+//			USART2 interrupt does while the firmware waits.
+//--------------------------------------------------------------
+void Host_Wait(void)
+{
+	uint16_t frame = VGA.frame;
+
+	while((host_feed_len > 0) && (VGA.frame == frame))
+		hostReceive();
+	if(VGA.frame == frame)
+	{
+		host_time += HOST_FRAME_BYTES - host_frame_bytes;
+		host_frame_bytes = 0;
+		Host_VBlank();
+	}
+}
+
+//--------------------------------------------------------------
+// @brief The SysTick of the host: the bytes the UART received, at 115200 baud
+//--------------------------------------------------------------
+uint32_t HAL_GetTick(void)
+{
+	return (uint64_t)host_time * 10000 / 115200;
+}
+
+//--------------------------------------------------------------
+// @brief Function gives what the firmware sent over the UART since Host_UartClear
+// @details Everything from UART_Send/UART_Print, printf goes to stdout on the host.
+//
+// @return the text, '\0' terminated. The last bytes are lost when it is full.
+//--------------------------------------------------------------
+const char *Host_UartOutput(void)
+{
+	host_uart[host_uart_len] = '\0';
+	return host_uart;
+}
+
+void Host_UartClear(void)
+{
+	host_uart_len = 0;
+}
+
+//--------------------------------------------------------------
+// @brief Function calculates the FNV-1a checksum of VGA_RAM1
+//--------------------------------------------------------------
+uint64_t Host_Checksum(void)
+{
+	uint64_t hash = 0xcbf29ce484222325ull;
+	uint32_t i;
+
+	for(i = 0; i < sizeof(VGA_RAM1); i++)
+		hash = (hash ^ VGA_RAM1[i]) * 0x100000001b3ull;
+	return hash;
+}
+
+//--------------------------------------------------------------
+// @brief The vertical blank of TIM2_IRQHandler
+// @details The sprites are latched like UB_VGA_StartFrame does, the buffers are
+//			swapped when the main loop asked for it and doesn't draw.
+//--------------------------------------------------------------
+void Host_VBlank(void)
+{
+	uint8_t *buf;
+
+	UB_VGA_LatchSprites();
+	if(VGA.swap && !VGA.drawing)
+	{
+		buf = VGA.show_buf;
+		VGA.show_buf = VGA.draw_buf;
+		VGA.draw_buf = buf;
+		VGA.swap = 0;
+	}
+	VGA.frame++;
+}
+
+//--------------------------------------------------------------
+// @brief Function receives the next chunk of Host_Feed
+// @details At most half the receive DMA buffer, handed over like the DMA callbacks do
+//			(UART_RxCheck). After the last byte the line goes idle (UART_RxIdle).
+//			The vertical blank comes after every HOST_FRAME_BYTES.
+//--------------------------------------------------------------
+static void hostReceive(void)
+{
+	uint32_t n = RX_DMA_BUFLEN / 2;
+
+	if(n > host_feed_len)
+		n = host_feed_len;
+	if(n > HOST_FRAME_BYTES - host_frame_bytes)
+		n = HOST_FRAME_BYTES - host_frame_bytes;
+	host_feed_len -= n;
+	host_frame_bytes += n;
+	host_time += n;
+	while(n--)
+	{
+		input.dma_buffer_rx[host_dma_rx_pos] = *host_feed++;
+		host_dma_rx_pos = (host_dma_rx_pos + 1) % RX_DMA_BUFLEN;
+	}
+	host_dma_rx.NDTR = RX_DMA_BUFLEN - host_dma_rx_pos;
+	if(host_feed_len == 0)
+		UART_RxIdle();
+	else
+		UART_RxCheck();
+
+	if(host_frame_bytes == HOST_FRAME_BYTES)
+	{
+		host_frame_bytes = 0;
+		Host_VBlank();
+	}
+}
+
+uint32_t __get_BASEPRI(void)
+{
+	return 0;
+}
+
+void __set_BASEPRI(uint32_t basePri)
+{
+}
+
+void Error_Handler(void)
+{
+	fprintf(stderr, "host: Error_Handler\n");
+	exit(1);
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim)
+{
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start_IT(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma)
+{
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma)
+{
+	return HAL_OK;
+}
+
+// The transmit DMA is done at once, the bytes are kept for Host_UartOutput
+HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength)
+{
+	if(hdma != &hdma_usart2_tx)
+		return HAL_OK;
+
+	if(DataLength > sizeof(host_uart) - 1 - host_uart_len)
+		DataLength = sizeof(host_uart) - 1 - host_uart_len;
+	memcpy(&host_uart[host_uart_len], (const void *)(uintptr_t)SrcAddress, DataLength);
+	host_uart_len += DataLength;
+
+	if(hdma->XferCpltCallback != NULL)
+		hdma->XferCpltCallback(hdma);
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	if(Size > sizeof(host_uart) - 1 - host_uart_len)
+		Size = sizeof(host_uart) - 1 - host_uart_len;
+	memcpy(&host_uart[host_uart_len], pData, Size);
+	host_uart_len += Size;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
+{
+	return HAL_OK;
+}
+
+void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
+{
+}
+
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
+{
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+}
+
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin)
+{
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+}
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void)
+{
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Lock(void)
+{
+	return HAL_OK;
+}
+
+// Like the flash: bits can only be cleared
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint64_t Data)
+{
+	if((TypeProgram != FLASH_TYPEPROGRAM_WORD) || (Address & 3) || (Address < MACRO_START) || (Address >= MACRO_END))
+		return HAL_ERROR;
+	*(volatile uint32_t *)(uintptr_t)Address &= (uint32_t)Data;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *SectorError)
+{
+	if(pEraseInit->Sector != MACRO_SECTOR)
+		return HAL_ERROR;
+	memset((void *)MACRO_START, 0xFF, MACRO_END - MACRO_START);
+	return HAL_OK;
+}
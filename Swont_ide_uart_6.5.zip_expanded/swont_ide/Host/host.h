@@ -0,0 +1,30 @@
+/*
+ * host.h
+ *
+ *  Created on: 17 okt. 2026
+ *
+ * Included before every file of the host build (gcc -include host.h).
+ * The firmware is built for a PC: the HAL is replaced by hal_stubs.c.
+ */
+
+#ifndef HOST_HOST_H_
+#define HOST_HOST_H_
+
+#include <stdint.h>
+
+// The CMSIS core functions are ARM instructions, hal_stubs.c replaces them
+uint32_t __get_BASEPRI(void);
+void __set_BASEPRI(uint32_t basePri);
+
+// UB_VGA_WaitVBlank doesn't wait for an interrupt
+#define VGA_WAIT_HOOK() Host_Wait()
+
+void Host_Wait(void);
+void Host_VBlank(void);
+void Host_Init(uint8_t mode);
+void Host_Feed(const uint8_t *data, uint32_t len, void (*run_line)(void));
+const char *Host_UartOutput(void);
+void Host_UartClear(void);
+uint64_t Host_Checksum(void);
+
+#endif /* HOST_HOST_H_ */
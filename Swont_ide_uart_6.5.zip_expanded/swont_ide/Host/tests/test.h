@@ -0,0 +1,53 @@
+/*
+ * test.h
+ *
+ *  Created on: 17 okt. 2026
+ *
+ * The unit tests of the host build. A test is a function made with TEST(name), it is
+ * found by the runner (test_main.c) without a list. Every test starts with Host_Init(VGA_MODE_320x240x8).
+ */
+
+#ifndef HOST_TEST_H_
+#define HOST_TEST_H_
+
+#include "main.h"
+#include "Frontlayer.h"
+#include "logic_layer.h"
+#include "stm32_ub_vga_screen.h"
+#include "macro.h"
+#include "usart.h"
+#include <stdlib.h>
+
+typedef struct TEST_S
+{
+	const char *name;
+	void (*run)(void);
+	struct TEST_S *next;
+}TEST_S;
+
+void Test_Register(TEST_S *test);
+void Test_Fail(const char *file, int lnr, const char *what);
+void Test_FailEq(const char *file, int lnr, const char *what, long long got, long long expected);
+
+#define TEST(name) \
+	static void name(void); \
+	static TEST_S name##_test = {#name, name, NULL}; \
+	__attribute__((constructor)) static void name##_register(void) { Test_Register(&name##_test); } \
+	static void name(void)
+
+#define CHECK(cond) \
+	do { if(!(cond)) Test_Fail(__FILE__, __LINE__, #cond); } while(0)
+
+#define CHECK_EQ(a, b) \
+	do { long long a_ = (a), b_ = (b); if(a_ != b_) Test_FailEq(__FILE__, __LINE__, #a " == " #b, a_, b_); } while(0)
+
+// true when the firmware sent str over the UART
+#define CHECK_UART(str) \
+	CHECK(strstr(Host_UartOutput(), str) != NULL)
+
+void Test_Send(const char *str);
+void Test_Load(const void *data, uint16_t len);
+bool Test_Parse(const char *str);
+uint8_t Test_Pixel(uint16_t xp, uint16_t yp);
+
+#endif /* HOST_TEST_H_ */
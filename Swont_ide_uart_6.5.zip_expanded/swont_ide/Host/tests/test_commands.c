@@ -0,0 +1,311 @@
+/*
+ * test_commands.c
+ *
+ *  Created on: 17 okt. 2026
+ *
+ * Whole commands through the UART receive path: line assembly, batches, macros,
+ * the interrupt timing and the checksums of the benchmark scripts
+ */
+#include "test.h"
+#include "isr_stats.h"
+
+static uint32_t test_lines;
+
+static void testCountLine(void);
+static uint64_t testScript(const char *path);
+
+TEST(uart_lines)
+{
+	char lines[3 * RX_DMA_BUFLEN];
+	uint16_t i;
+
+	// lines end with CR or '.', LF is skipped, the DMA buffer wraps several times
+	memset(lines, 'x', sizeof(lines));
+	for(i = 40; i < sizeof(lines); i += 41)
+		lines[i] = (i % 2) ? '\r' : '.';
+	lines[sizeof(lines) - 1] = '\0';
+	test_lines = 0;
+	Host_Feed((const uint8_t *)lines, strlen(lines), testCountLine);
+	CHECK_EQ(test_lines, (sizeof(lines) - 1) / 41);
+	CHECK_EQ(input.line_overflow, 0);
+	CHECK_EQ(input.queue_overflow, 0);
+}
+
+TEST(uart_long_line)
+{
+	static char longline[LINE_BUFLEN + 10];
+
+	memset(longline, 'x', sizeof(longline));
+	longline[sizeof(longline) - 2] = '\r';
+	longline[sizeof(longline) - 1] = '\0';
+	test_lines = 0;
+	Host_Feed((const uint8_t *)longline, strlen(longline), testCountLine);
+	CHECK_EQ(test_lines, 1);
+	CHECK_EQ(input.line_overflow, 9);	//LINE_BUFLEN - 1 characters fit
+}
+
+TEST(uart_lines_per_frame)
+{
+	char lines[64 * 24];
+	uint16_t frame;
+	uint16_t len = 0;
+	uint16_t yp;
+
+	// two buffers: the swaps don't hold the UART queue up for a frame
+	UB_VGA_SetMode(VGA_MODE_320x240x4);
+	for(yp = 0; yp < 64; yp++)
+		len += sprintf(&lines[len], "lijn,0,%u,0,%u,rood,1\r", yp, yp);
+	frame = VGA.frame;
+	Test_Send(lines);
+	// more lines a frame than the queue holds, the last frame ends after the input
+	CHECK((uint16_t)(VGA.frame - frame - 1) * CMD_QUEUE_DEPTH < 64);
+	CHECK_EQ(input.queue_overflow, 0);
+	for(yp = 0; yp < 64; yp++)
+		CHECK_EQ(Test_Pixel(0, yp), VGA_COL_RED);
+}
+
+TEST(uart_frame_cut_off)
+{
+	const char cut[] = {(char)binSOF, 11, binLine, 5, 0, '\0'};
+	char lines[80];
+
+	// a pause after the frame was cut off: the next line is a new one
+	Test_Send(cut);
+	UB_VGA_WaitVBlank();
+	Test_Send("clearscreen,rood\r\n");
+	CHECK_UART("damaged frame");
+	CHECK_EQ(Test_Pixel(100, 100), VGA_COL_RED);
+
+	// no pause: the frame takes the lines in, the ones after its first '\n' are kept
+	Host_UartClear();
+	snprintf(lines, sizeof(lines), "%c%c%c%c%cclearscreen,blauw\r\nlijn,0,5,319,5,geel,1\r\nlijn,0,6,319,6,geel,1\r\n",
+			 binSOF, 30, binLine, 5, 1);
+	Test_Send(lines);
+	CHECK_UART("damaged frame");
+	CHECK_EQ(Test_Pixel(100, 100), VGA_COL_RED);	//the line the frame ended in is lost
+	CHECK_EQ(Test_Pixel(100, 5), VGA_COL_YELLOW);
+	CHECK_EQ(Test_Pixel(100, 6), VGA_COL_YELLOW);
+	CHECK_EQ(input.queue_overflow, 0);
+}
+
+TEST(uart_send)
+{
+	UART_Print("hallo");
+	UART_Print(" wereld");
+	CHECK(strcmp(Host_UartOutput(), "hallo wereld") == 0);
+}
+
+TEST(draw_command)
+{
+	Test_Send("rechthoek,10,10,5,5,rood,1,rood,1\r\n");
+	CHECK_EQ(Test_Pixel(12, 12), VGA_COL_RED);
+	Test_Send("clearscreen,blauw.");
+	CHECK_EQ(Test_Pixel(12, 12), VGA_COL_BLUE);
+}
+
+TEST(batch_commit)
+{
+	Test_Send("begin\rlijn,0,0,319,0,rood,1\r");
+	CHECK_EQ(Test_Pixel(100, 0), VGA_COL_WHITE);
+	Test_Send("commit\r");
+	CHECK_EQ(Test_Pixel(100, 0), VGA_COL_RED);
+
+	// a clearscreen drops what was recorded before it
+	Test_Send("begin\rlijn,0,5,319,5,rood,1\rclearscreen,geel\rlijn,0,6,319,6,rood,1\rcommit\r");
+	CHECK_EQ(Test_Pixel(100, 5), VGA_COL_YELLOW);
+	CHECK_EQ(Test_Pixel(100, 6), VGA_COL_RED);
+
+	Test_Send("commit\r");
+	CHECK_UART("commit without begin");
+}
+
+TEST(batch_color4)
+{
+	UB_VGA_SetMode(VGA_MODE_320x240x4);
+	Test_Send("begin\rlijn,0,0,319,0,rood,1\rtekst,10,10,zwart,abc,arial,1,vet\rcommit\r");
+	CHECK_EQ(Test_Pixel(100, 0), VGA_COL_RED);
+}
+
+TEST(mode_command)
+{
+	Test_Send("mode,160x120x8\rrechthoek,150,110,20,20,rood,1,rood,1\r");
+	CHECK_EQ(VGA.width, 160);
+	CHECK_EQ(VGA.height, 120);
+	CHECK_EQ(Test_Pixel(159, 119), VGA_COL_RED);
+
+	Test_Send("mode,320x480x4\rlijn,0,479,319,479,rood,1\r");
+	CHECK_EQ(VGA.height, 480);
+	CHECK_EQ(Test_Pixel(100, 479), VGA_COL_RED);
+
+	Test_Send("mode,800x600x8\r");
+	CHECK_UART("wrong mode");
+	CHECK_EQ(VGA.mode, VGA_MODE_320x480x4);
+
+	// an open batch is dropped with the screen
+	Host_UartClear();
+	Test_Send("begin\rclearscreen,rood\rmode,320x240x8\rcommit\r");
+	CHECK_UART("commit without begin");
+	CHECK_EQ(Test_Pixel(0, 0), VGA_COL_WHITE);
+}
+
+TEST(mode_text_command)
+{
+	Test_Send("mode,40x30\rclearscreen,blauw\rtekst,16,8,rood,Hi!,arial,1,normaal\r");
+	CHECK_EQ(VGA.cols, 40);
+	CHECK_EQ(Test_Pixel(0, 0), VGA_COL_BLUE);
+	CHECK_EQ(Test_Pixel(16, 8), VGA_COL_RED);	//'H' starts with ##...##.
+	CHECK_EQ(Test_Pixel(18, 8), VGA_COL_BLUE);
+	CHECK_EQ(Test_Pixel(34, 8), VGA_COL_BLUE);	//'!' starts with ...##...
+	CHECK_EQ(Test_Pixel(35, 8), VGA_COL_RED);
+
+	// a text off the cells is dropped
+	Test_Send("tekst,320,8,rood,x,arial,1,normaal\rtekst,0,240,rood,x,arial,1,normaal\r");
+	CHECK_EQ(Test_Pixel(0, 0), VGA_COL_BLUE);
+}
+
+TEST(sprite_commands)
+{
+	// bitmap 500 has a set bit at (2,4)
+	Test_Send("sprite,3,500,rood,0\rmove,3,50,60\r");
+	UB_VGA_WaitVBlank();
+	CHECK_EQ(Test_Pixel(52, 64), VGA_COL_RED);
+
+	// in a batch the sprites stay when a clearscreen drops the rest
+	Test_Send("begin\rmove,3,-50,60\rlijn,0,0,319,0,blauw,1\rclearscreen,geel\rcommit\r");
+	UB_VGA_WaitVBlank();
+	CHECK_EQ(Test_Pixel(52, 64), VGA_COL_YELLOW);
+	CHECK_EQ(Test_Pixel(100, 0), VGA_COL_YELLOW);
+
+	Test_Send("sprite,8,500,rood,0\r");
+	CHECK_UART("wrong sprite");
+}
+
+#if ISR_STATS
+TEST(stats_command)
+{
+	// the handlers don't run on the host, the measurements are made up
+	Test_Send("stats\r");
+	Host_UartClear();
+	ISR_STATS_Record(ISR_STAT_TIM2, 100);
+	ISR_STATS_Record(ISR_STAT_TIM2, 300);
+	ISR_STATS_Record(ISR_STAT_TIM2, 5000);
+	ISR_STATS_Record(ISR_STAT_TIM2, 100000);
+	ISR_STATS_Latency(ISR_STAT_LATENCY, 5, 2667, 2660);	//wrapped: 13 ticks
+
+	Test_Send("histogram,tim2\r");
+	CHECK_UART("<128: 1\n\r<512: 1\n\r<8192: 1\n\r>=16384: 1\n\r");
+	Test_Send("histogram,tim4\r");
+	CHECK_UART("unknown stat");
+	CHECK(strcmp(histogram_s.name, "tim4") == 0);
+	CHECK(strcmp(macro_s.name, "tim4") != 0);
+
+	Host_UartClear();
+	Test_Send("stats\r");
+	CHECK_UART("latency (tim2 only): n 1 min 26 mean 26 max 26\n\r");
+	CHECK_UART("tim2: n 4 min 100 mean 26350 max 100000\n\r");
+	CHECK_UART("tim3: n 0\n\r");
+	CHECK_UART("usart2: n 0\n\r");
+	CHECK(strstr(Host_UartOutput(), "dma2") == NULL);
+
+	// stats starts over
+	Host_UartClear();
+	Test_Send("stats\r");
+	CHECK_UART("tim2: n 0\n\r");
+	ISR_STATS_Record(ISR_STAT_TIM2, 40);
+	Test_Send("histogram,tim2\r");
+	CHECK_UART("<64: 1\n\r");
+	CHECK(strstr(Host_UartOutput(), "<128") == NULL);
+}
+#endif
+
+TEST(batch_full)
+{
+	uint16_t i;
+
+	Test_Send("begin\r");
+	for(i = 0; i < BATCH_BUFLEN / 12 + 10; i++)
+		Test_Send("lijn,0,0,319,0,rood,1\r");
+	CHECK_UART("batch full");
+	Test_Send("commit\r");
+	CHECK_EQ(Test_Pixel(100, 0), VGA_COL_RED);
+}
+
+TEST(macro_record_play)
+{
+	uint16_t len;
+
+	Test_Send("record,kader\rrechthoek,10,10,5,5,rood,1,rood,1\rsave\r");
+	CHECK_EQ(Test_Pixel(12, 12), VGA_COL_WHITE);	//recorded, not drawn
+
+	Test_Send("play,kader\r");
+	CHECK_EQ(Test_Pixel(12, 12), VGA_COL_RED);
+
+	CHECK(MACRO_Get(0, &len) == MACRO_Find("kader", &len));
+	CHECK(MACRO_Get(1, &len) == NULL);
+
+	// saving the same name replaces the macro
+	Test_Send("record,kader\rclearscreen,groen\rsave\rplay,kader\r");
+	CHECK_EQ(Test_Pixel(12, 12), VGA_COL_GREEN);
+
+	Host_UartClear();
+	Test_Send("erase,kader\rplay,kader\r");
+	CHECK_UART("unknown macro");
+
+	Host_UartClear();
+	Test_Send("save\r");
+	CHECK_UART("save without record");
+}
+
+TEST(macro_erase_all)
+{
+	uint16_t len;
+
+	Test_Send("record,a\rclearscreen,rood\rsave\rrecord,b\rclearscreen,blauw\rsave\r");
+	CHECK(MACRO_Get(1, &len) != NULL);
+	CHECK(MACRO_Find("a", &len) != NULL);
+	Test_Send("erase,*\r");
+	CHECK(MACRO_Find("a", &len) == NULL);
+	CHECK(MACRO_Find("b", &len) == NULL);
+}
+
+//--------------------------------------------------------------
+// The checksums of the benchmark scripts (make bench), update them
+// when a change of the drawing is intended
+//--------------------------------------------------------------
+TEST(script_checksums)
+{
+	CHECK_EQ(testScript("scripts/lines.txt"), 0x260cb9dcbf49a6a7ull);
+	CHECK_EQ(testScript("scripts/rectangles.txt"), 0xc896b7b53ebd066eull);
+	CHECK_EQ(testScript("scripts/text.txt"), 0x184b5c3a4a432d6aull);
+	CHECK_EQ(testScript("scripts/mixed.txt"), 0x914015b684c9d878ull);
+	CHECK_EQ(testScript("scripts/frames.bin"), 0x2d06904e048c5e70ull);
+}
+
+static void testCountLine(void)
+{
+	test_lines++;
+}
+
+//--------------------------------------------------------------
+// @brief Function sends a script to a white screen
+//
+// @return the checksum of VGA_RAM1 afterwards, 0 when the script can't be read
+//--------------------------------------------------------------
+static uint64_t testScript(const char *path)
+{
+	FILE *f = fopen(path, "rb");
+	static uint8_t script[16384];
+	size_t len;
+
+	if(f == NULL)
+	{
+		perror(path);
+		return 0;
+	}
+	len = fread(script, 1, sizeof(script), f);
+	fclose(f);
+
+	Host_Init(VGA_MODE_320x240x8);
+	Host_Feed(script, len, NULL);
+	return Host_Checksum();
+}
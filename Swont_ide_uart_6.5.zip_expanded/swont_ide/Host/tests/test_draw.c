@@ -0,0 +1,436 @@
+/*
+ * test_draw.c
+ *
+ *  Created on: 17 okt. 2026
+ *
+ * The draw functions of stm32_ub_vga_screen.c in the video modes, the text modes and the sprites
+ */
+#include "test.h"
+#include "bitmap.h"
+#include "tim.h"
+
+TEST(fill_screen_keeps_blanking)
+{
+	uint16_t yp;
+
+	UB_VGA_FillScreen(VGA_COL_BLUE);
+	for(yp = 0; yp < VGA.height; yp++)
+	{
+		CHECK_EQ(Test_Pixel(0, yp), VGA_COL_BLUE);
+		CHECK_EQ(Test_Pixel(VGA.width - 1, yp), VGA_COL_BLUE);
+		CHECK_EQ(VGA_RAM1[(yp * VGA.line_bytes) + VGA.width], VGA_COL_BLACK);
+	}
+}
+
+TEST(pixel_clipping)
+{
+	UB_VGA_SetPixel(0, 0, VGA_COL_RED);
+	UB_VGA_SetPixel(VGA.width, 0, VGA_COL_RED);		//outside, would be the blanking byte
+	UB_VGA_SetPixel(0, VGA.height, VGA_COL_RED);
+	CHECK_EQ(Test_Pixel(0, 0), VGA_COL_RED);
+	CHECK_EQ(VGA_RAM1[VGA.width], VGA_COL_BLACK);
+	CHECK_EQ(Test_Pixel(1, 0), VGA_COL_WHITE);
+}
+
+TEST(viewport_clipping)
+{
+	UB_VGA_SetViewport(10, 10, 20, 20);
+	UB_VGA_FillSpan(0, 15, VGA.width, VGA_COL_GREEN);
+	UB_VGA_SetPixel(5, 5, VGA_COL_GREEN);
+	UB_VGA_ResetViewport();
+
+	CHECK_EQ(Test_Pixel(9, 15), VGA_COL_WHITE);
+	CHECK_EQ(Test_Pixel(10, 15), VGA_COL_GREEN);
+	CHECK_EQ(Test_Pixel(29, 15), VGA_COL_GREEN);
+	CHECK_EQ(Test_Pixel(30, 15), VGA_COL_WHITE);
+	CHECK_EQ(Test_Pixel(5, 5), VGA_COL_WHITE);
+}
+
+TEST(line_endpoints)
+{
+	UB_VGA_SetLine(10, 50, 20, 50, VGA_COL_RED, 1);
+	CHECK_EQ(Test_Pixel(9, 50), VGA_COL_WHITE);
+	CHECK_EQ(Test_Pixel(10, 50), VGA_COL_RED);
+	CHECK_EQ(Test_Pixel(20, 50), VGA_COL_RED);
+	CHECK_EQ(Test_Pixel(21, 50), VGA_COL_WHITE);
+
+	// all octants reach both end points
+	UB_VGA_SetLine(100, 100, 60, 130, VGA_COL_BLUE, 1);
+	CHECK_EQ(Test_Pixel(100, 100), VGA_COL_BLUE);
+	CHECK_EQ(Test_Pixel(60, 130), VGA_COL_BLUE);
+	UB_VGA_SetLine(200, 200, 205, 150, VGA_COL_BLUE, 1);
+	CHECK_EQ(Test_Pixel(200, 200), VGA_COL_BLUE);
+	CHECK_EQ(Test_Pixel(205, 150), VGA_COL_BLUE);
+}
+
+TEST(line_full_range)
+{
+	uint64_t sum;
+
+	// the clipping of coordinates far off the screen, UBSan checks the overflow (make SAN=1 test)
+	UB_VGA_SetLine(0, 0, 65535, 65535, VGA_COL_RED, 1);
+	CHECK_EQ(Test_Pixel(0, 0), VGA_COL_RED);
+	CHECK_EQ(Test_Pixel(100, 100), VGA_COL_RED);
+	CHECK_EQ(Test_Pixel(239, 239), VGA_COL_RED);
+	CHECK_EQ(Test_Pixel(101, 100), VGA_COL_WHITE);
+
+	sum = Host_Checksum();
+	UB_VGA_SetLine(0, 65535, 65535, 0, VGA_COL_BLUE, 3);
+	CHECK_EQ(Host_Checksum(), sum);
+	UB_VGA_SetLine(65535, 10, 0, 10, VGA_COL_BLUE, 1);
+	CHECK_EQ(Test_Pixel(0, 10), VGA_COL_BLUE);
+	CHECK_EQ(Test_Pixel(319, 10), VGA_COL_BLUE);
+
+	// the widest line: the clip window grown by the width doesn't fit in 16 bits
+	UB_VGA_SetLine(10, 100, 20, 100, VGA_COL_GREEN, 65535);
+	CHECK_EQ(Test_Pixel(15, 0), VGA_COL_GREEN);
+	CHECK_EQ(Test_Pixel(15, 239), VGA_COL_GREEN);
+	CHECK_EQ(Test_Pixel(9, 100), VGA_COL_WHITE);
+}
+
+TEST(filled_rectangle)
+{
+	UB_VGA_DrawRectangle(50, 60, 20, 10, VGA_COL_YELLOW, 1, VGA_COL_RED, 2);
+	CHECK_EQ(Test_Pixel(50, 60), VGA_COL_RED);
+	CHECK_EQ(Test_Pixel(51, 61), VGA_COL_RED);
+	CHECK_EQ(Test_Pixel(60, 65), VGA_COL_YELLOW);
+	CHECK_EQ(Test_Pixel(49, 60), VGA_COL_WHITE);
+	CHECK_EQ(Test_Pixel(50, 59), VGA_COL_WHITE);
+	CHECK_EQ(Test_Pixel(70, 65), VGA_COL_RED);		//the width is the last column
+	CHECK_EQ(Test_Pixel(71, 65), VGA_COL_WHITE);
+	CHECK_EQ(Test_Pixel(60, 71), VGA_COL_WHITE);
+}
+
+TEST(rectangle_off_screen)
+{
+	// partly outside is clipped, nothing runs into the next line
+	UB_VGA_DrawRectangle(300, 230, 100, 100, VGA_COL_GREEN, 1, VGA_COL_GREEN, 1);
+	CHECK_EQ(Test_Pixel(VGA.width - 1, VGA.height - 1), VGA_COL_GREEN);
+	CHECK_EQ(VGA_RAM1[(231 * VGA.line_bytes) + VGA.width], VGA_COL_BLACK);
+	CHECK_EQ(Test_Pixel(0, 231), VGA_COL_WHITE);
+}
+
+TEST(color4_swap)
+{
+	UB_VGA_SetMode(VGA_MODE_320x240x4);
+	UB_VGA_FillScreen(VGA_COL_RED);
+	UB_VGA_SetPixel(3, 4, VGA_COL_BLUE);
+	UB_VGA_Swap();
+	CHECK_EQ(Test_Pixel(3, 4), VGA_COL_WHITE);	//not shown before the frame
+	UB_VGA_WaitVBlank();
+	CHECK_EQ(Test_Pixel(3, 4), VGA_COL_BLUE);
+	CHECK_EQ(Test_Pixel(2, 4), VGA_COL_RED);
+	CHECK_EQ(Test_Pixel(VGA.width - 1, VGA.height - 1), VGA_COL_RED);
+
+	// the next picture is drawn on top of the shown one
+	UB_VGA_StartDraw();
+	UB_VGA_SetPixel(2, 4, VGA_COL_GREEN);
+	UB_VGA_Swap();
+	UB_VGA_WaitVBlank();
+	CHECK_EQ(Test_Pixel(2, 4), VGA_COL_GREEN);
+	CHECK_EQ(Test_Pixel(3, 4), VGA_COL_BLUE);
+}
+
+TEST(color4_palette)
+{
+	UB_VGA_SetMode(VGA_MODE_320x240x4);
+	UB_VGA_FillScreen(VGA_COL_RED);
+	UB_VGA_Swap();
+	UB_VGA_WaitVBlank();
+	UB_VGA_SetPalette(5, VGA_COL_LIGHTGREEN);	//index 5 = rood in the default palette
+	CHECK_EQ(Test_Pixel(0, 0), VGA_COL_LIGHTGREEN);
+}
+
+TEST(modes_draw)
+{
+	uint8_t mode;
+	uint16_t w;
+	uint16_t h;
+
+	// in every pixel mode: the corners, a pixel between two others, a clipped line
+	for(mode = 0; mode < VGA_MODE_80x30; mode++)
+	{
+		CHECK(UB_VGA_SetMode(mode));
+		w = VGA.width;
+		h = VGA.height;
+		UB_VGA_FillScreen(VGA_COL_BLACK);
+		UB_VGA_SetPixel(w - 1, h - 1, VGA_COL_WHITE);
+		UB_VGA_SetPixel(9, 5, VGA_COL_WHITE);
+		UB_VGA_FillSpan(3, 7, w, VGA_COL_WHITE);
+		UB_VGA_Swap();
+		UB_VGA_WaitVBlank();
+		CHECK_EQ(Test_Pixel(0, 0), VGA_COL_BLACK);
+		CHECK_EQ(Test_Pixel(w - 1, h - 1), VGA_COL_WHITE);
+		CHECK_EQ(Test_Pixel(w - 2, h - 1), VGA_COL_BLACK);
+		CHECK_EQ(Test_Pixel(8, 5), VGA_COL_BLACK);
+		CHECK_EQ(Test_Pixel(9, 5), VGA_COL_WHITE);
+		CHECK_EQ(Test_Pixel(10, 5), VGA_COL_BLACK);
+		CHECK_EQ(Test_Pixel(2, 7), VGA_COL_BLACK);
+		CHECK_EQ(Test_Pixel(3, 7), VGA_COL_WHITE);
+		CHECK_EQ(Test_Pixel(w - 1, 7), VGA_COL_WHITE);
+		CHECK_EQ(Test_Pixel(w - 1, 8), VGA_COL_BLACK);
+		CHECK_EQ(Test_Pixel(w, 8), VGA_COL_BLACK);	//the blanking byte
+	}
+	CHECK(UB_VGA_SetMode(VGA_MODE_COUNT) == 0);
+
+	// the TIM2 CC3 interrupt (UB_VGA_StartFrame) is masked while the mode changes, only then
+	CHECK(__HAL_TIM_GET_IT_SOURCE(&htim2, TIM_IT_CC3) == SET);
+	__HAL_TIM_DISABLE_IT(&htim2, TIM_IT_CC3);
+	UB_VGA_SetMode(VGA_MODE_320x240x8);
+	CHECK(__HAL_TIM_GET_IT_SOURCE(&htim2, TIM_IT_CC3) == RESET);
+	__HAL_TIM_ENABLE_IT(&htim2, TIM_IT_CC3);
+}
+
+TEST(mode_1bpp)
+{
+	UB_VGA_SetMode(VGA_MODE_640x480x1);
+	CHECK_EQ(VGA.line_bytes, 80);
+
+	// colors are black or white, a column leaves its neighbours in the byte
+	UB_VGA_FillScreen(VGA_COL_YELLOW);
+	UB_VGA_DrawRectangle(13, 100, 0, 50, VGA_COL_BLUE, 1, VGA_COL_BLUE, 1);
+	UB_VGA_Swap();
+	UB_VGA_WaitVBlank();
+	CHECK_EQ(Test_Pixel(12, 120), VGA_COL_WHITE);
+	CHECK_EQ(Test_Pixel(13, 120), VGA_COL_BLACK);
+	CHECK_EQ(Test_Pixel(14, 120), VGA_COL_WHITE);
+
+	// the palette has two entries
+	UB_VGA_SetPalette(1, VGA_COL_GREEN);
+	UB_VGA_SetPalette(2, VGA_COL_RED);
+	CHECK_EQ(Test_Pixel(12, 120), VGA_COL_GREEN);
+	CHECK_EQ(Test_Pixel(13, 120), VGA_COL_BLACK);
+}
+
+TEST(mode_free_ram)
+{
+	uint8_t *ram;
+	uint32_t len;
+
+	ram = UB_VGA_GetFreeRam(&len);
+	CHECK_EQ(len, 0);
+	CHECK(ram == &VGA_RAM1[VGA_RAM_BYTES]);
+
+	UB_VGA_SetMode(VGA_MODE_160x120x8);
+	ram = UB_VGA_GetFreeRam(&len);
+	CHECK_EQ(len, VGA_RAM_BYTES - (161 * 120));
+	CHECK_EQ((uintptr_t)ram & 0x03, 0);
+	memset(ram, 0x55, len);		//the screen stays white
+	CHECK_EQ(Test_Pixel(159, 119), VGA_COL_WHITE);
+
+	UB_VGA_SetMode(VGA_MODE_640x480x1);
+	UB_VGA_GetFreeRam(&len);
+	CHECK_EQ(len, VGA_RAM_BYTES - (2 * 80 * 480));
+}
+
+TEST(text_cells)
+{
+	uint16_t *cells;
+	uint64_t sum;
+	uint32_t len;
+	uint8_t attr;
+
+	UB_VGA_SetMode(VGA_MODE_80x30);
+	CHECK_EQ(VGA.cols, 80);
+	CHECK_EQ(VGA.rows, 30);
+	UB_VGA_GetFreeRam(&len);
+	CHECK_EQ(len, VGA_RAM_BYTES - (80 * 30 * 2));
+	CHECK_EQ(Test_Pixel(639, 239), VGA_COL_WHITE);
+
+	// 'A' in cell (1, 2): the top row of the glyph is ..###...
+	attr = UB_VGA_TextAttr(VGA_COL_RED, VGA_COL_BLUE);
+	UB_VGA_PutChar(1, 2, 'A', attr);
+	CHECK_EQ(Test_Pixel(9, 16), VGA_COL_BLUE);
+	CHECK_EQ(Test_Pixel(10, 16), VGA_COL_RED);
+	CHECK_EQ(Test_Pixel(12, 16), VGA_COL_RED);
+	CHECK_EQ(Test_Pixel(13, 16), VGA_COL_BLUE);
+	CHECK_EQ(Test_Pixel(10, 23), VGA_COL_BLUE);
+	CHECK_EQ(Test_Pixel(16, 16), VGA_COL_WHITE);
+
+	// the pixel functions leave the cells alone
+	sum = Host_Checksum();
+	UB_VGA_SetPixel(0, 0, VGA_COL_RED);
+	UB_VGA_SetLine(0, 0, 639, 239, VGA_COL_RED, 3);
+	UB_VGA_DrawRectangle(0, 0, 100, 100, VGA_COL_RED, 1, VGA_COL_RED, 1);
+	UB_VGA_DrawBitmap(0, 0, 500, VGA_COL_RED, 1);
+	UB_VGA_SetViewport(0, 0, 100, 100);
+	UB_VGA_FillSpan(0, 0, 100, VGA_COL_RED);
+	CHECK_EQ(Host_Checksum(), sum);
+
+	// a text stops at the end of the row
+	cells = (uint16_t *)VGA.draw_buf;
+	UB_VGA_PutText(78, 0, "abcd", attr);
+	CHECK_EQ(cells[79], 'b' | (attr << 8));
+	CHECK_EQ(cells[80], ' ' | (UB_VGA_TextAttr(VGA_COL_BLACK, VGA_COL_WHITE) << 8));
+
+	// scrolling moves the rows up, the palette colors the cells
+	UB_VGA_ScrollText(1, UB_VGA_TextAttr(VGA_COL_BLACK, VGA_COL_GREEN));
+	CHECK_EQ(Test_Pixel(10, 8), VGA_COL_RED);
+	CHECK_EQ(Test_Pixel(0, 239), VGA_COL_GREEN);
+	UB_VGA_SetPalette(attr & 0x0F, VGA_COL_YELLOW);
+	CHECK_EQ(Test_Pixel(10, 8), VGA_COL_YELLOW);
+	UB_VGA_ScrollText(255, attr);
+	CHECK_EQ(cells[(30 * 80) - 1], ' ' | (attr << 8));
+}
+
+TEST(sprites)
+{
+	const BM_INFO_t *bm = Bitmap_find(500);
+	const uint8_t *src = &bitmap_1bpp[bm->offset];
+	uint64_t sum = Host_Checksum();
+	uint8_t px;
+	uint8_t py;
+	uint8_t bit;
+
+	// the clear bits show the picture
+	CHECK(UB_VGA_SetSprite(0, 500, VGA_COL_RED, 1));
+	UB_VGA_MoveSprite(0, 10, 20);
+	UB_VGA_WaitVBlank();
+	for(py = 0; py < bm->y_len; py++)
+	{
+		for(px = 0; px < bm->x_len; px++)
+		{
+			bit = src[(py * BM_ROW_BYTES(bm->x_len)) + (px >> 3)] & (0x80 >> (px & 0x07));
+			CHECK_EQ(Test_Pixel(10 + px, 20 + py), bit ? VGA_COL_RED : VGA_COL_WHITE);
+		}
+	}
+	for(px = 0; (px < bm->x_len) && (Test_Pixel(10 + px, 24) == VGA_COL_WHITE); px++);
+	CHECK(px < bm->x_len);
+
+	// a move is shown from the next frame on, nothing is drawn into the buffer
+	UB_VGA_MoveSprite(0, 100, 20);
+	CHECK_EQ(Test_Pixel(10 + px, 24), VGA_COL_RED);
+	UB_VGA_WaitVBlank();
+	CHECK_EQ(Test_Pixel(10 + px, 24), VGA_COL_WHITE);
+	CHECK_EQ(Test_Pixel(100 + px, 24), VGA_COL_RED);
+	CHECK_EQ(Host_Checksum(), sum);
+
+	// the higher z on top
+	UB_VGA_SetSprite(1, 500, VGA_COL_BLUE, 0);
+	UB_VGA_MoveSprite(1, 100, 20);
+	UB_VGA_WaitVBlank();
+	CHECK_EQ(Test_Pixel(100 + px, 24), VGA_COL_RED);
+	UB_VGA_SetSprite(1, 500, VGA_COL_BLUE, 2);
+	UB_VGA_WaitVBlank();
+	CHECK_EQ(Test_Pixel(100 + px, 24), VGA_COL_BLUE);
+
+	// clipped at the edges, the blanking byte stays black
+	UB_VGA_MoveSprite(0, VGA.width - 2, VGA.height - 2);
+	UB_VGA_MoveSprite(1, -5, -6);
+	CHECK(UB_VGA_SetSprite(2, 9999, VGA_COL_RED, 0) == 0);
+	UB_VGA_WaitVBlank();
+	CHECK_EQ(Test_Pixel(VGA.width, VGA.height - 1), VGA_COL_BLACK);
+	CHECK_EQ(Host_Checksum(), sum);
+
+	// the sprites are over the expanded lines too, in any 8-bit color
+	UB_VGA_HideSprite(1);
+	UB_VGA_SetMode(VGA_MODE_320x240x4);
+	UB_VGA_SetSprite(0, 500, 0x49, 1);
+	UB_VGA_MoveSprite(0, 10, 20);
+	UB_VGA_WaitVBlank();
+	CHECK_EQ(Test_Pixel(10 + px, 24), 0x49);
+	UB_VGA_HideSprite(0);
+	UB_VGA_WaitVBlank();
+	CHECK_EQ(Test_Pixel(10 + px, 24), VGA_COL_WHITE);
+}
+
+TEST(dirty_areas)
+{
+	const VGA_VIEWPORT_t *rects;
+
+	// one buffer: nothing to copy, nothing kept
+	UB_VGA_SetPixel(5, 6, VGA_COL_RED);
+	UB_VGA_FillScreen(VGA_COL_WHITE);
+	CHECK_EQ(UB_VGA_GetDirty(&rects), 0);
+
+	UB_VGA_SetMode(VGA_MODE_320x240x4);
+	UB_VGA_SetPixel(5, 6, VGA_COL_RED);
+	CHECK_EQ(UB_VGA_GetDirty(&rects), 1);
+	CHECK_EQ(rects[0].x0, 5);
+	CHECK_EQ(rects[0].y0, 6);
+	CHECK_EQ(rects[0].x1, 5);
+	CHECK_EQ(rects[0].y1, 6);
+
+	UB_VGA_SetPixel(6, 6, VGA_COL_RED);	//touching, merged
+	CHECK_EQ(UB_VGA_GetDirty(&rects), 1);
+	CHECK_EQ(rects[0].x1, 6);
+
+	UB_VGA_SetPixel(100, 100, VGA_COL_RED);
+	CHECK_EQ(UB_VGA_GetDirty(&rects), 2);
+
+	UB_VGA_FillScreen(VGA_COL_WHITE);
+	CHECK_EQ(UB_VGA_GetDirty(&rects), 1);
+}
+
+TEST(bitmap_directory)
+{
+	uint8_t seen[BM_AMOUNT] = {0};
+	const BM_INFO_t *bm;
+	uint32_t id;
+	uint16_t found = 0;
+
+	// every ID resolves to its own entry, inside bitmap_1bpp
+	for(id = 0; id <= 0xFFFF; id++)
+	{
+		bm = Bitmap_find(id);
+		if(bm == NULL)
+			continue;
+		found++;
+		CHECK(seen[bm - bmInfo] == 0);
+		seen[bm - bmInfo] = 1;
+		CHECK(bm->offset + (bm->y_len * BM_ROW_BYTES(bm->x_len)) <= BM_AMOUNT * TEXT_SIZE * BM_ROW_BYTES(TEXT_SIZE));
+	}
+	CHECK_EQ(found, BM_AMOUNT);
+
+	CHECK(Bitmap_find('a') == &bmInfo[0]);
+	CHECK(Bitmap_find('Z') == &bmInfo[(ALPHABET_SIZE * 2) - 1]);
+	CHECK(Bitmap_find(551) == &bmInfo[BM_AMOUNT - 1]);
+	CHECK(Bitmap_find(52) == NULL);
+	CHECK(Bitmap_find(552) == NULL);
+
+	// the font sets agree with the IDs
+	CHECK(Bitmap_glyph(ARIAL_FONT, BOLD_STYLE, 'a') == Bitmap_find('A'));
+	CHECK(Bitmap_glyph(CONSOLAS_FONT, NORMAL_STYLE, 'z') == Bitmap_find(51));
+	CHECK(Bitmap_glyph(CONSOLAS_FONT, CURSIVE_STYLE, 'a') == Bitmap_find(526));
+}
+
+TEST(consolas_glyphs)
+{
+	uint64_t glyph;
+
+	// Consolas starts at ID 26 and 526, the first letter of the font in bitmap_1bpp
+	CHECK(Bitmap_glyph(CONSOLAS_FONT, NORMAL_STYLE, 'a') == Bitmap_find(26));
+	CHECK(Bitmap_glyph(CONSOLAS_FONT, CURSIVE_STYLE, 'a') == Bitmap_find(526));
+
+	// the text draws the same pixels as the bitmap with that ID
+	UB_VGA_DrawBitmap(10, 10, 26, VGA_COL_BLACK, 0);
+	glyph = Host_Checksum();
+	UB_VGA_FillScreen(VGA_COL_WHITE);
+	UB_VGA_writeText(10, 10, VGA_COL_BLACK, "a", CONSOLAS_FONT, 1, NORMAL_STYLE);
+	CHECK_EQ(Host_Checksum(), glyph);
+
+	UB_VGA_FillScreen(VGA_COL_WHITE);
+	UB_VGA_DrawBitmap(10, 10, 526, VGA_COL_BLACK, 0);
+	glyph = Host_Checksum();
+	UB_VGA_FillScreen(VGA_COL_WHITE);
+	UB_VGA_writeText(10, 10, VGA_COL_BLACK, "a", CONSOLAS_FONT, 1, CURSIVE_STYLE);
+	CHECK_EQ(Host_Checksum(), glyph);
+}
+
+TEST(text_and_bitmap)
+{
+	uint64_t white = Host_Checksum();
+
+	UB_VGA_writeText(10, 10, VGA_COL_BLACK, "ab", ARIAL_FONT, 1, NORMAL_STYLE);
+	CHECK(Host_Checksum() != white);
+	UB_VGA_FillScreen(VGA_COL_WHITE);
+	UB_VGA_DrawBitmap(100, 100, 500, VGA_COL_BLACK, 0);
+	CHECK(Host_Checksum() != white);
+
+	// unknown bitmaps and letters draw nothing
+	UB_VGA_FillScreen(VGA_COL_WHITE);
+	UB_VGA_DrawBitmap(100, 100, 9999, VGA_COL_BLACK, 0);
+	UB_VGA_writeText(10, 10, VGA_COL_BLACK, "#", ARIAL_FONT, 1, NORMAL_STYLE);
+	CHECK_EQ(Test_Pixel(100, 100), VGA_COL_WHITE);
+	CHECK_EQ(Test_Pixel(10, 10), VGA_COL_WHITE);
+}
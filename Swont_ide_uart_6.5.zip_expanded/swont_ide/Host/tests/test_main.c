@@ -0,0 +1,123 @@
+/*
+ * test_main.c
+ *
+ *  Created on: 17 okt. 2026
+ *
+ * The unit-test runner of the host build.
+ *
+ * usage: tests [name...]
+ *   without names all tests run, otherwise the tests whose name contains one of the names
+ */
+#include "test.h"
+
+static TEST_S *tests;
+static TEST_S **tests_end = &tests;
+static int test_failed;		//checks that failed in the running test
+static char test_line[LINE_BUFLEN];
+
+static bool testSelected(const char *name, int argc, char *argv[]);
+
+int main(int argc, char *argv[])
+{
+	TEST_S *t;
+	int run = 0;
+	int failed = 0;
+
+	for(t = tests; t != NULL; t = t->next)
+	{
+		if(testSelected(t->name, argc, argv) == false)
+			continue;
+		Host_Init(VGA_MODE_320x240x8);
+		test_failed = 0;
+		t->run();
+		run++;
+		if(test_failed != 0)
+		{
+			failed++;
+			printf("FAIL %s\n", t->name);
+		}
+	}
+
+	printf("%d tests, %d failed\n", run, failed);
+	return (failed != 0) || (run == 0);
+}
+
+//--------------------------------------------------------------
+// @brief Function adds a test at the end of the list, called before main
+//--------------------------------------------------------------
+void Test_Register(TEST_S *test)
+{
+	*tests_end = test;
+	tests_end = &test->next;
+}
+
+void Test_Fail(const char *file, int lnr, const char *what)
+{
+	printf("%s:%d: check failed: %s\n", file, lnr, what);
+	test_failed++;
+}
+
+void Test_FailEq(const char *file, int lnr, const char *what, long long got, long long expected)
+{
+	printf("%s:%d: check failed: %s, got %lld (0x%llx), expected %lld (0x%llx)\n",
+		   file, lnr, what, got, got, expected, expected);
+	test_failed++;
+}
+
+//--------------------------------------------------------------
+// @brief Function sends text to the firmware like a terminal, see Host_Feed
+//--------------------------------------------------------------
+void Test_Send(const char *str)
+{
+	Host_Feed((const uint8_t *)str, strlen(str), NULL);
+}
+
+//--------------------------------------------------------------
+// @brief Function loads a line (without CR) the way UART_GetLine does
+// @details FL_Input reads it next, call it until it returns false.
+//--------------------------------------------------------------
+void Test_Load(const void *data, uint16_t len)
+{
+	memcpy(test_line, data, len);
+	test_line[len] = '\0';
+	input.line_rx_buffer = test_line;
+	input.msglen = len;
+}
+
+//--------------------------------------------------------------
+// @brief Function parses a text line
+//
+// @return the result of FL_Input, fl_function and the structs hold the function
+//--------------------------------------------------------------
+bool Test_Parse(const char *str)
+{
+	bool result;
+
+	Test_Load(str, strlen(str));
+	result = FL_Input();
+	if(result == true)
+		FL_Input();	//ends the line
+	return result;
+}
+
+//--------------------------------------------------------------
+// @brief Function reads the color of a shown pixel, in every video mode, sprites included
+//--------------------------------------------------------------
+uint8_t Test_Pixel(uint16_t xp, uint16_t yp)
+{
+	return ((const uint8_t *)(uintptr_t)UB_VGA_ScanLine(yp))[xp];
+}
+
+static bool testSelected(const char *name, int argc, char *argv[])
+{
+	int i;
+
+	if(argc < 2)
+		return true;
+	for(i = 1; i < argc; i++)
+	{
+		if(strstr(name, argv[i]) != NULL)
+			return true;
+	}
+	return false;
+}
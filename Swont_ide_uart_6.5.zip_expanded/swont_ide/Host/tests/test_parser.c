@@ -0,0 +1,258 @@
+/*
+ * test_parser.c
+ *
+ *  Created on: 17 okt. 2026
+ *
+ * FL_Input: text lines, binary frames and the name tables of logic_layer.c
+ */
+#include "test.h"
+
+static uint16_t testCrc(const uint8_t *c, uint16_t len);
+
+TEST(parse_line)
+{
+	CHECK(Test_Parse("lijn,1,2,300,200,rood,5"));
+	CHECK_EQ(fl_function, line);
+	CHECK_EQ(line_s.x1, 1);
+	CHECK_EQ(line_s.y1, 2);
+	CHECK_EQ(line_s.x2, 300);
+	CHECK_EQ(line_s.y2, 200);
+	CHECK_EQ(line_s.color, VGA_COL_RED);
+	CHECK_EQ(line_s.weight, 5);
+}
+
+TEST(parse_rectangle)
+{
+	CHECK(Test_Parse("rechthoek,10,20,30,40,lichtblauw,1,bruin,2"));
+	CHECK_EQ(fl_function, rectangle);
+	CHECK_EQ(rectangle_s.xlup, 10);
+	CHECK_EQ(rectangle_s.ylup, 20);
+	CHECK_EQ(rectangle_s.width, 30);
+	CHECK_EQ(rectangle_s.height, 40);
+	CHECK_EQ(rectangle_s.color, VGA_COL_LIGHTBLUE);
+	CHECK_EQ(rectangle_s.filled, 1);
+	CHECK_EQ(rectangle_s.bordercolor, VGA_COL_BROWN);
+	CHECK_EQ(rectangle_s.linewidth, 2);
+}
+
+TEST(parse_text_keeps_spaces)
+{
+	CHECK(Test_Parse("tekst,5,6,zwart, hallo wereld ,consolas,2,cursief"));
+	CHECK_EQ(fl_function, text);
+	CHECK_EQ(text_s.xlup, 5);
+	CHECK_EQ(text_s.ylup, 6);
+	CHECK_EQ(text_s.color, VGA_COL_BLACK);
+	CHECK(strcmp(text_s.textin, " hallo wereld ") == 0);
+	CHECK_EQ(text_s.fontname, CONSOLAS_FONT);
+	CHECK_EQ(text_s.fontsize, 2);
+	CHECK_EQ(text_s.fontstyle, CURSIVE_STYLE);
+}
+
+TEST(parse_bitmap_and_clearscreen)
+{
+	CHECK(Test_Parse("bitmap,500,7,8"));
+	CHECK_EQ(fl_function, bitmap);
+	CHECK_EQ(bitmap_s.nr, 500);
+	CHECK_EQ(bitmap_s.xlup, 7);
+	CHECK_EQ(bitmap_s.ylup, 8);
+
+	CHECK(Test_Parse("clearscreen,geel"));
+	CHECK_EQ(fl_function, clearscreen);
+	CHECK_EQ(clearscreen_s.color, VGA_COL_YELLOW);
+}
+
+TEST(parse_numbers)
+{
+	// spaces are skipped, also inside a number, a sign is allowed
+	CHECK(Test_Parse("lijn, 1 0 ,+20, 3x,-1,rood, 2"));
+	CHECK_EQ(line_s.x1, 10);
+	CHECK_EQ(line_s.y1, 20);
+	CHECK_EQ(line_s.x2, 3);
+	CHECK_EQ(line_s.y2, (uint16_t)-1);
+	CHECK_EQ(line_s.weight, 2);
+}
+
+TEST(parse_number_range)
+{
+	CHECK(Test_Parse("lijn,2147483647,-2147483647,0,0,rood,1"));
+	CHECK_EQ(line_s.x1, (uint16_t)2147483647);
+	CHECK_EQ(line_s.y1, (uint16_t)-2147483647);
+
+	// too many digits: the line is rejected, UBSan checks the overflow (make SAN=1 test)
+	CHECK(Test_Parse("lijn,99999999999,0,10,10,rood,1") == false);
+	CHECK_UART("number out of range");
+	CHECK(Test_Parse("lijn,0,0,10,-2147483648,rood,1") == false);
+
+	// the next line is read again
+	CHECK(Test_Parse("lijn,1,2,3,4,rood,1"));
+	CHECK_EQ(line_s.x1, 1);
+}
+
+TEST(parse_argument_count)
+{
+	CHECK(Test_Parse("lijn,1,2,3,4,rood") == false);
+	CHECK_UART("not enough arguments");
+
+	Host_UartClear();
+	CHECK(Test_Parse("bitmap,1,2,3,4"));
+	CHECK_UART("exceeds the maximum length");
+}
+
+TEST(parse_unknown_names)
+{
+	CHECK(Test_Parse("lijn,1,2,3,4,paars,5") == false);
+	CHECK_UART("wrong color");
+
+	Host_UartClear();
+	CHECK(Test_Parse("tekst,1,2,rood,a,times,1,vet") == false);
+	CHECK_UART("wrong font");
+	CHECK(strstr(Host_UartOutput(), "wrong color") == NULL);
+
+	Host_UartClear();
+	CHECK(Test_Parse("tekst,1,2,rood,a,arial,1,dik") == false);
+	CHECK_UART("wrong style");
+
+	// every message ends the line
+	Host_UartClear();
+	CHECK(Test_Parse("xyz,1") == false);
+	CHECK(strcmp(Host_UartOutput(), "Error: the function name is not correct\n\r") == 0);
+}
+
+TEST(name_tables)
+{
+	CHECK_EQ(color_check("zwart"), VGA_COL_BLACK);
+	CHECK_EQ(color_check("wit"), VGA_COL_WHITE);
+	CHECK_EQ(color_check("lichtmagenta"), VGA_COL_LIGHTMAGENTA);
+	CHECK_EQ(color_check("grijs"), VGA_COL_GRAY);
+	CHECK_EQ(color_check(""), -1);
+	CHECK_EQ(color_check("zwartt"), -1);
+	CHECK_EQ(font_check("ariel"), ARIAL_FONT);
+	CHECK_EQ(font_check("consolas"), CONSOLAS_FONT);
+	CHECK_EQ(style_check("normaal"), NORMAL_STYLE);
+	CHECK_EQ(style_check("vet"), BOLD_STYLE);
+	CHECK_EQ(mode_check("160x120x8"), VGA_MODE_160x120x8);
+	CHECK_EQ(mode_check("640x480x1"), VGA_MODE_640x480x1);
+	CHECK_EQ(mode_check("640x480x8"), -1);
+	CHECK_EQ(mode_check("80x30"), VGA_MODE_80x30);
+	CHECK_EQ(mode_check("40x30"), VGA_MODE_40x30);
+}
+
+TEST(parse_words)
+{
+	// whole words win from the first letter
+	CHECK(Test_Parse("begin"));
+	CHECK_EQ(fl_function, batchBegin);
+	CHECK(Test_Parse(" commit "));
+	CHECK_EQ(fl_function, batchCommit);
+	CHECK(Test_Parse("play,logo"));
+	CHECK_EQ(fl_function, macroPlay);
+	CHECK(strcmp(macro_s.name, "logo") == 0);
+	CHECK(Test_Parse("record") == false);
+	CHECK(Test_Parse("mode,80x30"));
+	CHECK_EQ(fl_function, videoMode);
+	CHECK(strcmp(mode_s.name, "80x30") == 0);
+	CHECK(strcmp(macro_s.name, "logo") == 0);	//the macro name is left alone
+	CHECK(Test_Parse("b,1,2,3"));
+	CHECK_EQ(fl_function, bitmap);
+}
+
+TEST(parse_binary_frame)
+{
+	uint8_t frame[32];
+	uint16_t len = 0;
+	uint16_t crc;
+
+	frame[len++] = binSOF;
+	frame[len++] = 0;
+	frame[len++] = binLine;
+	frame[len++] = 10; frame[len++] = 0;
+	frame[len++] = 20; frame[len++] = 0;
+	frame[len++] = 0x2C; frame[len++] = 0x01;	//300
+	frame[len++] = 200; frame[len++] = 0;
+	frame[len++] = 7;	//rood
+	frame[len++] = 3;
+	frame[len++] = binClearscreen;
+	frame[len++] = 14;	//wit
+	frame[len++] = binPlay;
+	frame[len++] = 2;
+	frame[len++] = binMove;
+	frame[len++] = 3;
+	frame[len++] = 0xFB; frame[len++] = 0xFF;	//-5
+	frame[len++] = 60; frame[len++] = 0;
+	frame[1] = len - binHeaderLen;
+	crc = testCrc(&frame[1], len - 1);
+	frame[len++] = crc;
+	frame[len++] = crc >> 8;
+
+	Test_Load(frame, len);
+	CHECK(FL_Input());
+	CHECK_EQ(fl_function, line);
+	CHECK_EQ(line_s.x2, 300);
+	CHECK_EQ(line_s.color, VGA_COL_RED);
+	CHECK_EQ(line_s.weight, 3);
+	CHECK(FL_Input());
+	CHECK_EQ(fl_function, clearscreen);
+	CHECK_EQ(clearscreen_s.color, VGA_COL_WHITE);
+	CHECK(FL_Input());
+	CHECK_EQ(fl_function, macroPlay);
+	CHECK_EQ(macro_s.nr, 2);
+	CHECK_EQ(macro_s.name[0], '\0');
+	CHECK(FL_Input());
+	CHECK_EQ(fl_function, spriteMove);
+	CHECK_EQ(move_s.nr, 3);
+	CHECK_EQ(move_s.x, -5);
+	CHECK_EQ(move_s.y, 60);
+	CHECK(FL_Input() == false);
+
+	frame[3] ^= 1;	//damaged
+	Test_Load(frame, len);
+	CHECK(FL_Input() == false);
+	CHECK_UART("damaged frame");
+}
+
+TEST(parse_binary_text)
+{
+	uint8_t frame[] = {binSOF, 11, binText, 10, 0, 20, 0, 7, CONSOLAS_FONT, 2, CURSIVE_STYLE, 1, 'a', 0, 0};
+	uint16_t crc;
+	uint8_t i;
+
+	crc = testCrc(&frame[1], sizeof(frame) - 1 - binCrcLen);
+	frame[13] = crc;
+	frame[14] = crc >> 8;
+	Test_Load(frame, sizeof(frame));
+	CHECK(FL_Input());
+	CHECK_EQ(fl_function, text);
+	CHECK_EQ(text_s.fontname, CONSOLAS_FONT);
+	CHECK_EQ(text_s.fontsize, 2);
+	CHECK_EQ(text_s.fontstyle, CURSIVE_STYLE);
+	CHECK(strcmp(text_s.textin, "a") == 0);
+	CHECK(FL_Input() == false);
+
+	// a font or a style the text line wouldn't take either
+	for(i = 0; i < 4; i++)
+	{
+		frame[8] = (i == 0) ? 0 : (i == 1) ? CONSOLAS_FONT + 1 : CONSOLAS_FONT;
+		frame[10] = (i == 2) ? 0 : (i == 3) ? CURSIVE_STYLE + 1 : CURSIVE_STYLE;
+		crc = testCrc(&frame[1], sizeof(frame) - 1 - binCrcLen);
+		frame[13] = crc;
+		frame[14] = crc >> 8;
+		Test_Load(frame, sizeof(frame));
+		CHECK(FL_Input() == false);
+		CHECK_UART("wrong binary function");
+		Host_UartClear();
+	}
+}
+
+static uint16_t testCrc(const uint8_t *c, uint16_t len)
+{
+	uint16_t crc = 0xFFFF;
+	uint8_t bit;
+
+	while(len--)
+	{
+		crc ^= *c++ << 8;
+		for(bit = 0; bit < 8; bit++)
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+	}
+	return crc;
+}